@@ -22,7 +22,10 @@
  * SOFTWARE.
  */
 
-#define MOVEMENT_LONG_PRESS_TICKS 64
+// button timing, in ticks of the 1024 Hz watch timer: how long a button has to be held to make a long press, and how
+// soon after a click the next press has to start to make a double click.
+#define MOVEMENT_LONG_PRESS_TICKS (WATCH_TIMER_TICKS_PER_SECOND / 2)
+#define MOVEMENT_DOUBLE_CLICK_TICKS (WATCH_TIMER_TICKS_PER_SECOND * 3 / 10)
 
 #include <stdio.h>
 #include <string.h>
@@ -51,7 +54,10 @@
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
+#include "watch_display_stats.h"
 void _wake_up_simulator(void);
+#elif WATCH_POSIX
+#include <time.h>
 #else
 #include "watch_usb_cdc.h"
 #endif
@@ -59,25 +65,189 @@ void _wake_up_simulator(void);
 volatile movement_state_t movement_state;
 void * watch_face_contexts[MOVEMENT_NUM_FACES];
 watch_date_time_t scheduled_tasks[MOVEMENT_NUM_FACES];
+// indices of the faces with a pending background task, sorted so that the soonest deadline comes first.
+static uint8_t _movement_task_queue[MOVEMENT_NUM_FACES];
+static uint8_t _movement_task_queue_len = 0;
+// the minute (date_time.reg >> 6) whose top was last handled, so that the alarm and _movement_program_alarm don't
+// both take the same one.
+static volatile uint32_t _movement_last_minute_reached;
+
+// what each face asked to be advised about, and the dispatch lists we build from that. the timed list is sorted by
+// minute of the day, so the top-of-minute handler can stop looking as soon as it passes the current time.
+static movement_advise_interest_t _movement_advise_interest[MOVEMENT_NUM_FACES];
+static uint16_t _movement_advise_minute_of_day[MOVEMENT_NUM_FACES];
+static uint8_t _movement_advise_every_minute[MOVEMENT_NUM_FACES];
+static uint8_t _movement_advise_every_minute_len = 0;
+static uint8_t _movement_advise_hourly[MOVEMENT_NUM_FACES];
+static uint8_t _movement_advise_hourly_len = 0;
+static uint8_t _movement_advise_timed[MOVEMENT_NUM_FACES];
+static uint8_t _movement_advise_timed_len = 0;
+static uint8_t _movement_num_advising_faces = 0;
+
+// the last reading of each sensor and when we took it, plus how often each face wants them sampled.
+#define MOVEMENT_SENSOR_MAX_AGE 60
+typedef struct {
+    uint32_t taken_at;  // UTC unix time, or 0 if we haven't taken one yet.
+    float value;
+} movement_sensor_reading_t;
+static movement_sensor_reading_t _movement_sensor_readings[MOVEMENT_NUM_SENSORS];
+static uint8_t _movement_sensor_interest[MOVEMENT_NUM_SENSORS][MOVEMENT_NUM_FACES];
+static uint8_t _movement_num_sensor_subscriptions = 0;
+static void _movement_sample_scheduled_sensors(watch_date_time_t date_time, watch_date_time_t local_date_time);
+
+#ifndef MOVEMENT_WAKE_TRACE_LENGTH
+#define MOVEMENT_WAKE_TRACE_LENGTH 64
+#endif
+
+// a ring of the most recent wakes. On the watch it goes in .noinit, which startup leaves alone, so the trace outlives a
+// soft reset; the magic number tells us whether what we find there is a trace or whatever RAM powered up with.
+#define MOVEMENT_WAKE_TRACE_MAGIC 0x57414b45
+typedef struct {
+    uint32_t magic;
+    uint16_t head;      // where the next entry goes
+    uint16_t length;
+    movement_wake_trace_entry_t entries[MOVEMENT_WAKE_TRACE_LENGTH];
+} movement_wake_trace_t;
+#if __EMSCRIPTEN__ || WATCH_POSIX
+static movement_wake_trace_t _movement_wake_trace;
+#else
+static movement_wake_trace_t _movement_wake_trace __attribute__((section(".noinit")));
+#endif
+// interrupt handlers note what woke us here; the wake in progress is written to the trace once we go back to sleep.
+static volatile uint8_t _movement_wake_sources = 0;
+static bool _movement_wake_in_progress = false;
+static movement_wake_trace_entry_t _movement_current_wake;
+static uint32_t _movement_current_wake_us;
+
+#ifndef MOVEMENT_LOW_ENERGY_FRAMES
+#define MOVEMENT_LOW_ENERGY_FRAMES 16
+#endif
+
+// low energy frames drawn ahead of time, for faces that allow it. the first frame is for the minute starting at
+// _movement_le_frames_start (UTC, in minutes since the epoch). while we draw them, movement_get_local_date_time
+// returns _movement_le_render_time instead of the time.
+static bool _movement_le_prerender[MOVEMENT_NUM_FACES];
+static watch_display_frame_t _movement_le_frames[MOVEMENT_LOW_ENERGY_FRAMES];
+static uint32_t _movement_le_frames_start;
+static uint8_t _movement_le_frames_count = 0;
+static watch_date_time_t _movement_le_render_time;
+static bool _movement_le_rendering = false;
+
+// per-face accounting of where our awake time goes; see the `stats` shell command.
+static movement_face_stats_t _movement_face_stats[MOVEMENT_NUM_FACES];
+
+// after waking from low energy mode, a face's setup is deferred until Movement next needs to call into that face.
+static bool _movement_face_needs_setup[MOVEMENT_NUM_FACES];
+
+// the settings and the location are journaled in the RTC's backup registers; they only go to flash when we change faces
+// or go to sleep, so a run of changes costs one write (if any) instead of one per change.
+#define MOVEMENT_SETTINGS_BACKUP_REGISTER 0
+#define MOVEMENT_LOCATION_BACKUP_REGISTER 1
+static volatile bool _movement_settings_dirty = false;
+static volatile bool _movement_location_dirty = false;
+
+#ifndef MOVEMENT_FACE_ARENA_SIZE
+#define MOVEMENT_FACE_ARENA_SIZE 2048
+#endif
+
+// face contexts are allocated once, in setup, and never freed, so a bump allocator over a static arena is all they
+// need; unlike the heap, it can't fragment, and its size is fixed when we link.
+#define MOVEMENT_FACE_ARENA_ALIGNMENT 8
+#define MOVEMENT_FACE_CONTEXT_BYTES(size) (((size) + MOVEMENT_FACE_ARENA_ALIGNMENT - 1) & ~(MOVEMENT_FACE_ARENA_ALIGNMENT - 1))
+
+// the Makefile has face_registry.py add up every allocation the faces in watch_faces[] make in setup.
+#ifdef MOVEMENT_FACE_CONTEXTS_SIZE
+_Static_assert(MOVEMENT_FACE_CONTEXTS_SIZE <= MOVEMENT_FACE_ARENA_SIZE,
+               "the faces in movement_config.h need more memory than MOVEMENT_FACE_ARENA_SIZE; raise it or remove a face");
+#endif
+static uint8_t _movement_face_arena[MOVEMENT_FACE_ARENA_SIZE] __attribute__((aligned(MOVEMENT_FACE_ARENA_ALIGNMENT)));
+static size_t _movement_face_arena_used = 0;
+static movement_face_memory_t _movement_face_memory[MOVEMENT_NUM_FACES];
+// the face whose setup is running, so its allocations can be charged to it.
+static int16_t _movement_face_in_setup = -1;
+
+typedef enum {
+    MOVEMENT_BUTTON_LIGHT = 0,
+    MOVEMENT_BUTTON_MODE,
+    MOVEMENT_BUTTON_ALARM,
+    MOVEMENT_NUM_BUTTONS
+} movement_button_t;
+
+typedef struct {
+    movement_event_type_t down_event;   // the button's DOWN event; its UP, LONG_PRESS and LONG_UP events follow in order.
+    uint16_t down_at;                   // watch timer count when the button went down.
+    uint16_t clicked_at;                // watch timer count when the button last came up from a short press.
+    bool is_down;
+    bool long_pressed;                  // the long press event has fired for the current press.
+    bool clicked;                       // clicked_at is recent enough that the next press could make a double click.
+    bool double_clicking;               // the current press started soon enough after a click to make a double click.
+} movement_button_state_t;
+
+static volatile movement_button_state_t _movement_buttons[MOVEMENT_NUM_BUTTONS] = {
+    { .down_event = EVENT_LIGHT_BUTTON_DOWN },
+    { .down_event = EVENT_MODE_BUTTON_DOWN },
+    { .down_event = EVENT_ALARM_BUTTON_DOWN },
+};
+
+// long presses, the LED timeout and the double click window are deadlines on the watch timer, which wakes us only
+// when the soonest of them comes due. the long press deadlines share their indices with the buttons.
+typedef enum {
+    MOVEMENT_DEADLINE_LIGHT_LONG_PRESS = 0,
+    MOVEMENT_DEADLINE_MODE_LONG_PRESS,
+    MOVEMENT_DEADLINE_ALARM_LONG_PRESS,
+    MOVEMENT_DEADLINE_LED_OFF,
+    MOVEMENT_DEADLINE_CLICK_WINDOW,
+    MOVEMENT_NUM_DEADLINES
+} movement_deadline_t;
+
+static volatile uint16_t _movement_deadline_at[MOVEMENT_NUM_DEADLINES];
+static volatile bool _movement_deadline_pending[MOVEMENT_NUM_DEADLINES];
+
+// time from leaving the low energy loop to the end of the foreground face's EVENT_ACTIVATE.
+static bool _movement_wake_latency_pending = false;
+static uint32_t _movement_wake_started_at = 0;
+static uint32_t _movement_last_wake_latency_us = 0;
 const int32_t movement_le_inactivity_deadlines[8] = {INT_MAX, 600, 3600, 7200, 21600, 43200, 86400, 604800};
 const int16_t movement_timeout_inactivity_deadlines[4] = {60, 120, 300, 1800};
-movement_event_t event;
+
+// Events are pushed by the interrupt callbacks and drained by app_loop. All of the producers run in interrupt
+// context at the same priority, so they never preempt one another, and app_loop is the only consumer; that makes
+// this a single-producer, single-consumer ring, and neither side ever needs to mask interrupts. Nothing outside of an
+// interrupt may push: when the foreground touches the deadlines, anything that has come due is left to the timer.
+#define MOVEMENT_EVENT_QUEUE_SIZE 16 // must be a power of two
+
+static movement_event_t _movement_event_queue[MOVEMENT_EVENT_QUEUE_SIZE];
+static volatile uint8_t _movement_event_queue_head = 0;  // next slot to write; only advanced by the ISRs
+static volatile uint8_t _movement_event_queue_tail = 0;  // next slot to read; only advanced by app_loop
+static bool _movement_activate_pending = false;
+// whether the last pass through app_loop let us sleep. if it didn't, the next pass is a continuation, not a wake.
+static bool _movement_slept_after_last_pass = false;
 
 int8_t _movement_dst_offset_cache[NUM_ZONE_NAMES] = {0};
 #define TIMEZONE_DOES_NOT_OBSERVE (-127)
 
+// For each zone, the UTC timestamp at which its offset next changes, so that most minutes cost one comparison against
+// the soonest of them. Zones that don't observe DST never change; zones we haven't looked ahead for yet are resolved a
+// few at a time at the top of the minute, and until then get rechecked every 30 minutes like before.
+uint32_t _movement_dst_next_transition[NUM_ZONE_NAMES] = {0};
+uint32_t _movement_dst_soonest_transition = 0;
+#define DST_TRANSITION_UNKNOWN 0
+#define DST_TRANSITION_NEVER UINT32_MAX
+#define DST_TRANSITION_PROBE_STEP (7 * 86400)       // no zone changes its offset twice in a week
+#define DST_TRANSITION_HORIZON (366 * 86400)        // if nothing changes within a year, look again in a year
+#define DST_ZONES_RESOLVED_PER_MINUTE 4
+
 void cb_mode_btn_interrupt(void);
 void cb_light_btn_interrupt(void);
 void cb_alarm_btn_interrupt(void);
 void cb_alarm_btn_extwake(void);
 void cb_alarm_fired(void);
-void cb_fast_tick(void);
 void cb_tick(void);
 
 void cb_accelerometer_event(void);
 void cb_accelerometer_wake(void);
 
-#if __EMSCRIPTEN__
+#if __EMSCRIPTEN__ || WATCH_POSIX
 void yield(void) {
 }
 #else
@@ -99,109 +269,572 @@ static udatetime_t _movement_convert_date_time_to_udate(watch_date_time_t date_t
     };
 }
 
-static bool _movement_update_dst_offset_cache(void) {
+static int8_t _movement_dst_offset_at(uzone_t *zone, uint32_t timestamp) {
+    // utz expects the zone's standard local time.
+    watch_date_time_t date_time = watch_utility_date_time_from_unix_time(timestamp, zone->offset.hours * 3600 + zone->offset.minutes * 60);
+    udatetime_t udate_time = _movement_convert_date_time_to_udate(date_time);
+    uoffset_t offset;
+    get_current_offset(zone, &udate_time, &offset);
+    return (offset.hours * 60 + offset.minutes) / 15;
+}
+
+static uint32_t _movement_find_next_dst_transition(uzone_t *zone, uint32_t now, int8_t current_offset) {
+    // transitions happen on the minute, so do all of our probing on minute boundaries.
+    uint32_t low = now - now % 60;
+    uint32_t high = low;
+
+    // step forward a week at a time until the offset changes...
+    do {
+        low = high;
+        high += DST_TRANSITION_PROBE_STEP;
+        if (high - now > DST_TRANSITION_HORIZON) return high;
+    } while (_movement_dst_offset_at(zone, high) == current_offset);
+
+    // ...then narrow it down to the first minute of the new offset.
+    while (high - low > 60) {
+        uint32_t mid = low + ((high - low) / 120) * 60;
+        if (_movement_dst_offset_at(zone, mid) == current_offset) low = mid;
+        else high = mid;
+    }
+
+    return high;
+}
+
+static bool _movement_update_dst_offset_for_zone(uint8_t zone_index, uint32_t now, bool find_next_transition) {
     uzone_t local_zone;
-    udatetime_t udate_time;
+    unpack_zone(&zone_defns[zone_index], "", &local_zone);
+
+    if (!local_zone.rules_len) {
+        // if the zone has no DST rules, set the cache to a constant value that indicates no DST check needs to be performed.
+        _movement_dst_offset_cache[zone_index] = TIMEZONE_DOES_NOT_OBSERVE;
+        _movement_dst_next_transition[zone_index] = DST_TRANSITION_NEVER;
+        return false;
+    }
+
+    int8_t new_offset = _movement_dst_offset_at(&local_zone, now);
+    bool dst_changed = _movement_dst_offset_cache[zone_index] != new_offset;
+    _movement_dst_offset_cache[zone_index] = new_offset;
+    _movement_dst_next_transition[zone_index] = find_next_transition ? _movement_find_next_dst_transition(&local_zone, now, new_offset) : DST_TRANSITION_UNKNOWN;
+
+    return dst_changed;
+}
+
+static void _movement_update_soonest_dst_transition(void) {
+    _movement_dst_soonest_transition = DST_TRANSITION_NEVER;
+    for (uint8_t i = 0; i < NUM_ZONE_NAMES; i++) {
+        uint32_t transition = _movement_dst_next_transition[i];
+        // an unresolved zone means we still have work to do next minute.
+        if (transition < _movement_dst_soonest_transition) _movement_dst_soonest_transition = transition;
+    }
+}
+
+/// Recomputes the current offset for every zone. Since the clock may have just jumped, we forget where each zone's next
+/// transition was; the top-of-minute handler works those out again a few at a time.
+static bool _movement_update_dst_offset_cache(void) {
+    bool dst_changed = false;
+    uint32_t now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+
+    for (uint8_t i = 0; i < NUM_ZONE_NAMES; i++) {
+        if (_movement_update_dst_offset_for_zone(i, now, false)) dst_changed = true;
+    }
+    // the wearer's own zone is the one they'll look at, so don't leave it waiting.
+    _movement_update_dst_offset_for_zone(movement_state.settings.bit.time_zone, now, true);
+    _movement_update_soonest_dst_transition();
+
+    return dst_changed;
+}
+
+static bool _movement_handle_dst_transitions(watch_date_time_t date_time) {
+    uint32_t now = watch_utility_date_time_to_unix_time(date_time, 0);
     bool dst_changed = false;
-    watch_date_time_t system_date_time = watch_rtc_get_date_time();
+    uint8_t zones_to_resolve = DST_ZONES_RESOLVED_PER_MINUTE;
+
+    // the usual case: no zone anywhere is due to change, and nothing is left to resolve.
+    if (now < _movement_dst_soonest_transition) return false;
 
     for (uint8_t i = 0; i < NUM_ZONE_NAMES; i++) {
-        unpack_zone(&zone_defns[i], "", &local_zone);
-        watch_date_time_t date_time = watch_utility_date_time_convert_zone(system_date_time, 0, local_zone.offset.hours * 3600 + local_zone.offset.minutes * 60);
-
-        if (!!local_zone.rules_len) {
-            // if local zone has DST rules, we need to see if DST applies.
-            udate_time = _movement_convert_date_time_to_udate(date_time);
-            uoffset_t offset;
-            get_current_offset(&local_zone, &udate_time, &offset);
-            int8_t new_offset = (offset.hours * 60 + offset.minutes) / 15;
-            if (_movement_dst_offset_cache[i] != new_offset) {
-                _movement_dst_offset_cache[i] = new_offset;
-                dst_changed = true;
+        uint32_t transition = _movement_dst_next_transition[i];
+        if (transition == DST_TRANSITION_UNKNOWN) {
+            if (zones_to_resolve) {
+                zones_to_resolve--;
+                if (_movement_update_dst_offset_for_zone(i, now, true)) dst_changed = true;
+            } else if (date_time.unit.minute % 30 == 0) {
+                // not resolved yet; keep its offset fresh the old-fashioned way.
+                if (_movement_update_dst_offset_for_zone(i, now, false)) dst_changed = true;
             }
-        } else {
-            // otherwise set the cache to a constant value that indicates no DST check needs to be performed.
-            _movement_dst_offset_cache[i] = TIMEZONE_DOES_NOT_OBSERVE;
+        } else if (transition <= now) {
+            if (_movement_update_dst_offset_for_zone(i, now, true)) dst_changed = true;
         }
     }
+    _movement_update_soonest_dst_transition();
 
     return dst_changed;
 }
 
+#if __EMSCRIPTEN__
+static inline uint32_t _movement_stats_counter(void) {
+    return (uint32_t)(emscripten_get_now() * 1000.0);
+}
+
+static inline uint32_t _movement_stats_elapsed_us(uint32_t start) {
+    return _movement_stats_counter() - start;
+}
+#elif WATCH_POSIX
+static inline uint32_t _movement_stats_counter(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000 + now.tv_nsec / 1000);
+}
+
+static inline uint32_t _movement_stats_elapsed_us(uint32_t start) {
+    return _movement_stats_counter() - start;
+}
+#else
+// SysTick counts down at the CPU clock from 0xFFFFFF, so this wraps every two seconds at 8 MHz; no face should spend
+// anywhere near that long in a single callback.
+static inline uint32_t _movement_stats_counter(void) {
+    return SysTick->VAL;
+}
+
+static inline uint32_t _movement_stats_elapsed_us(uint32_t start) {
+    uint32_t cycles = (start - SysTick->VAL) & SysTick_LOAD_RELOAD_Msk;
+    // we run at 4 MHz, or 8 MHz when USB is enabled.
+    return usb_is_enabled() ? cycles >> 3 : cycles >> 2;
+}
+#endif
+
+static void _movement_wake_trace_begin(void) {
+    if (_movement_wake_in_progress) return;
+    _movement_wake_in_progress = true;
+    _movement_current_wake.woke_at = watch_rtc_get_date_time().reg;
+    _movement_current_wake.face_index = movement_state.current_face_idx;
+    _movement_current_wake_us = 0;
+}
+
+static void _movement_wake_trace_count(uint32_t started_at) {
+    // saturate rather than wrap; with USB connected, a wake can go on for hours.
+    uint32_t elapsed_us = _movement_stats_elapsed_us(started_at);
+    _movement_current_wake_us = (_movement_current_wake_us > UINT32_MAX - elapsed_us) ? UINT32_MAX : _movement_current_wake_us + elapsed_us;
+}
+
+static void _movement_wake_trace_end(void) {
+    if (!_movement_wake_in_progress) return;
+    _movement_wake_in_progress = false;
+
+    uint8_t sources = _movement_wake_sources;
+    _movement_wake_sources = 0;
+    // the buzzer's sequencer and USB don't call back into Movement when they wake us, so check on them here.
+    if (movement_state.is_buzzing) sources |= MOVEMENT_WAKE_BUZZER;
+    if (usb_is_enabled()) sources |= MOVEMENT_WAKE_USB;
+    _movement_current_wake.sources = sources;
+    uint32_t awake_ms = _movement_current_wake_us / 1000;
+    // on the watch, SysTick wraps every few seconds, so a pass longer than that (an alarm sequence, or drawing the
+    // low energy frames) comes up short. the RTC only counts whole seconds, but it doesn't wrap: if it says we were
+    // awake for longer than that, believe it instead.
+    watch_date_time_t woke_at = { .reg = _movement_current_wake.woke_at };
+    watch_date_time_t now = watch_rtc_get_date_time();
+    // most wakes are over within the second they started in, and then there's nothing to work out.
+    if (now.reg != woke_at.reg) {
+        uint32_t rtc_awake_s = watch_utility_date_time_to_unix_time(now, 0) - watch_utility_date_time_to_unix_time(woke_at, 0);
+        if (rtc_awake_s > UINT16_MAX / 1000) awake_ms = UINT16_MAX;
+        else if (rtc_awake_s > 1 && awake_ms < (rtc_awake_s - 1) * 1000) awake_ms = rtc_awake_s * 1000;
+    }
+    _movement_current_wake.awake_ms = awake_ms > UINT16_MAX ? UINT16_MAX : awake_ms;
+
+    _movement_wake_trace.entries[_movement_wake_trace.head] = _movement_current_wake;
+    _movement_wake_trace.head = (_movement_wake_trace.head + 1) % MOVEMENT_WAKE_TRACE_LENGTH;
+    if (_movement_wake_trace.length < MOVEMENT_WAKE_TRACE_LENGTH) _movement_wake_trace.length++;
+}
+
+static void _movement_call_face_setup(uint8_t watch_face_index) {
+    _movement_face_in_setup = watch_face_index;
+    watch_faces[watch_face_index].setup(watch_face_index, &watch_face_contexts[watch_face_index]);
+    _movement_face_in_setup = -1;
+}
+
+static void _movement_ensure_face_setup(uint8_t watch_face_index) {
+    if (!_movement_face_needs_setup[watch_face_index]) return;
+
+    _movement_face_needs_setup[watch_face_index] = false;
+    _movement_call_face_setup(watch_face_index);
+}
+
+static bool _movement_call_face_loop(uint8_t watch_face_index, movement_event_t event) {
+    movement_face_stats_t *stats = &_movement_face_stats[watch_face_index];
+    _movement_ensure_face_setup(watch_face_index);
+    uint32_t start = _movement_stats_counter();
+
+#if __EMSCRIPTEN__
+    // one commit can hold several events' worth of drawing, so the simulator counts each event's writes here.
+    watch_display_stats_begin_event(event.event_type);
+#endif
+    bool can_sleep = watch_faces[watch_face_index].loop(event, watch_face_contexts[watch_face_index]);
+#if __EMSCRIPTEN__
+    watch_display_stats_begin_event(EVENT_NONE);
+#endif
+
+    uint32_t elapsed = _movement_stats_elapsed_us(start);
+    stats->active_us += elapsed;
+    if (elapsed > stats->worst_loop_us) stats->worst_loop_us = elapsed;
+    if (event.event_type < MOVEMENT_NUM_EVENT_TYPES) stats->loop_calls[event.event_type]++;
+    if (!can_sleep) stats->stay_awake_count++;
+
+    return can_sleep;
+}
+
+static void _movement_queue_event(movement_event_type_t event_type, uint8_t subsecond) {
+    uint8_t head = _movement_event_queue_head;
+    uint8_t count = (uint8_t)(head - _movement_event_queue_tail);
+
+    // if the newest event still waiting in the queue is a tick, a second tick tells the face nothing new;
+    // app_loop hands the face the current subsecond when it delivers the tick, so we can drop this one.
+    if (event_type == EVENT_TICK && count > 0 &&
+        _movement_event_queue[(uint8_t)(head - 1) & (MOVEMENT_EVENT_QUEUE_SIZE - 1)].event_type == EVENT_TICK) {
+        return;
+    }
+
+    if (count >= MOVEMENT_EVENT_QUEUE_SIZE) {
+        movement_state.event_queue_overflows++;
+        return;
+    }
+
+    movement_event_t *slot = &_movement_event_queue[head & (MOVEMENT_EVENT_QUEUE_SIZE - 1)];
+    slot->event_type = event_type;
+    slot->subsecond = subsecond;
+    // only publish the slot once it has been filled in.
+    __asm__ volatile("" ::: "memory");
+    _movement_event_queue_head = head + 1;
+}
+
+static bool _movement_dequeue_event(movement_event_t *event) {
+    uint8_t tail = _movement_event_queue_tail;
+    if (tail == _movement_event_queue_head) return false;
+
+    *event = _movement_event_queue[tail & (MOVEMENT_EVENT_QUEUE_SIZE - 1)];
+    __asm__ volatile("" ::: "memory");
+    _movement_event_queue_tail = tail + 1;
+
+    return true;
+}
+
+static inline void _movement_flush_event_queue(void) {
+    _movement_event_queue_tail = _movement_event_queue_head;
+}
+
 static inline void _movement_reset_inactivity_countdown(void) {
     movement_state.le_mode_ticks = movement_le_inactivity_deadlines[movement_state.settings.bit.le_interval];
     movement_state.timeout_ticks = movement_timeout_inactivity_deadlines[movement_state.settings.bit.to_interval];
 }
 
-static inline void _movement_enable_fast_tick_if_needed(void) {
-    if (!movement_state.fast_tick_enabled) {
-        movement_state.fast_ticks = 0;
-        watch_rtc_register_periodic_callback(cb_fast_tick, 128);
-        movement_state.fast_tick_enabled = true;
+static void _movement_service_deadlines(bool in_interrupt);
+
+static void _movement_timer_fired(void) {
+    _movement_wake_sources |= MOVEMENT_WAKE_TIMER;
+    _movement_service_deadlines(true);
+}
+
+// for the button interrupts.
+static void _movement_set_deadline(movement_deadline_t deadline, uint16_t ticks_from_now) {
+    watch_timer_enable();
+    _movement_deadline_at[deadline] = watch_timer_get_count() + ticks_from_now;
+    _movement_deadline_pending[deadline] = true;
+    _movement_service_deadlines(true);
+}
+
+static void _movement_clear_deadline(movement_deadline_t deadline) {
+    _movement_deadline_pending[deadline] = false;
+    _movement_service_deadlines(true);
+}
+
+// for everything else. a button interrupt landing between reading the deadlines and aiming the timer would have its
+// own deadline overwritten, so hold interrupts off for the duration.
+static void _movement_set_deadline_from_foreground(movement_deadline_t deadline, uint16_t ticks_from_now) {
+    watch_enter_critical_section();
+    watch_timer_enable();
+    _movement_deadline_at[deadline] = watch_timer_get_count() + ticks_from_now;
+    _movement_deadline_pending[deadline] = true;
+    _movement_service_deadlines(false);
+    watch_exit_critical_section();
+}
+
+static void _movement_clear_deadline_from_foreground(movement_deadline_t deadline) {
+    watch_enter_critical_section();
+    _movement_deadline_pending[deadline] = false;
+    _movement_service_deadlines(false);
+    watch_exit_critical_section();
+}
+
+static void _movement_deadline_expired(movement_deadline_t deadline) {
+    switch (deadline) {
+        case MOVEMENT_DEADLINE_LIGHT_LONG_PRESS:
+        case MOVEMENT_DEADLINE_MODE_LONG_PRESS:
+        case MOVEMENT_DEADLINE_ALARM_LONG_PRESS:
+            // the long press deadlines line up with the buttons.
+            if (_movement_buttons[deadline].is_down) {
+                _movement_buttons[deadline].long_pressed = true;
+                _movement_queue_event(_movement_buttons[deadline].down_event + 2, 0);
+            }
+            break;
+        case MOVEMENT_DEADLINE_LED_OFF:
+            if (movement_state.light_state == MOVEMENT_LIGHT_TIMED) movement_state.light_state = MOVEMENT_LIGHT_EXPIRED;
+            break;
+        case MOVEMENT_DEADLINE_CLICK_WINDOW:
+            for (uint8_t i = 0; i < MOVEMENT_NUM_BUTTONS; i++) _movement_buttons[i].clicked = false;
+            break;
+        default:
+            break;
+    }
+}
+
+static void _movement_service_deadlines(bool in_interrupt) {
+    // fire everything that has come due, then aim the timer at whatever comes due next. if the counter gets there
+    // while we're still setting up the compare, the compare won't fire until the counter wraps, so check and go again.
+    // outside of an interrupt nothing fires; a deadline that has come due is aimed a little way ahead instead (further
+    // each time around, so that we can't keep missing it), and the timer's interrupt fires it.
+    int16_t lead = 1;
+    while (true) {
+        uint16_t now = watch_timer_get_count();
+        int16_t soonest = INT16_MAX;
+        bool any_pending = false;
+
+        for (uint8_t i = 0; i < MOVEMENT_NUM_DEADLINES; i++) {
+            if (!_movement_deadline_pending[i]) continue;
+            int16_t remaining = (int16_t)(_movement_deadline_at[i] - now);
+            if (remaining <= 0) {
+                if (in_interrupt) {
+                    _movement_deadline_pending[i] = false;
+                    _movement_deadline_expired(i);
+                    continue;
+                }
+                remaining = lead;
+            }
+            any_pending = true;
+            if (remaining < soonest) soonest = remaining;
+        }
+
+        if (!any_pending) {
+            watch_timer_disable_compare_callback();
+            break;
+        }
+
+        uint16_t next = now + soonest;
+        watch_timer_register_compare_callback(_movement_timer_fired, next);
+        if ((int16_t)(watch_timer_get_count() - next) < 0) return;
+        if (lead < WATCH_TIMER_TICKS_PER_SECOND) lead *= 2;
+    }
+
+    // with nothing left to wait for, the counter can stop, unless a button is down and we need to time its release.
+    for (uint8_t i = 0; i < MOVEMENT_NUM_BUTTONS; i++) if (_movement_buttons[i].is_down) return;
+    for (uint8_t i = 0; i < MOVEMENT_NUM_BUTTONS; i++) _movement_buttons[i].clicked = false;
+    watch_timer_disable();
+}
+
+static void _movement_cancel_deadlines(void) {
+    watch_enter_critical_section();
+    for (uint8_t i = 0; i < MOVEMENT_NUM_DEADLINES; i++) _movement_deadline_pending[i] = false;
+    for (uint8_t i = 0; i < MOVEMENT_NUM_BUTTONS; i++) {
+        _movement_buttons[i].is_down = false;
+        _movement_buttons[i].clicked = false;
+    }
+    watch_timer_disable();
+    watch_exit_critical_section();
+}
+
+static void _movement_task_queue_remove(uint8_t watch_face_index) {
+    for(uint8_t i = 0; i < _movement_task_queue_len; i++) {
+        if (_movement_task_queue[i] == watch_face_index) {
+            _movement_task_queue_len--;
+            memmove(&_movement_task_queue[i], &_movement_task_queue[i + 1], _movement_task_queue_len - i);
+            return;
+        }
+    }
+}
+
+static void _movement_task_queue_insert(uint8_t watch_face_index) {
+    uint8_t i = _movement_task_queue_len;
+    // walk back from the end until we find a deadline that comes before ours.
+    while (i > 0 && scheduled_tasks[_movement_task_queue[i - 1]].reg > scheduled_tasks[watch_face_index].reg) {
+        _movement_task_queue[i] = _movement_task_queue[i - 1];
+        i--;
+    }
+    _movement_task_queue[i] = watch_face_index;
+    _movement_task_queue_len++;
+}
+
+static void _movement_count_down_untimed_seconds(uint8_t second);
+
+// called from the alarm interrupt at second 0, and from _movement_program_alarm in case the alarm missed it. whichever
+// gets there first for a given minute does the work.
+static void _movement_top_of_minute_reached(watch_date_time_t date_time) {
+    // the seconds live in the low six bits of the register, so everything above them identifies the minute.
+    uint32_t minute = date_time.reg >> 6;
+    if (minute == _movement_last_minute_reached) return;
+    _movement_last_minute_reached = minute;
+
+    movement_state.woke_from_alarm_handler = true;
+    // with the tick turned off, the top of the minute is our only chance to run the inactivity countdowns.
+    if (movement_state.tick_frequency == 0) {
+        _movement_count_down_untimed_seconds(60);
+        // faces that refresh once a minute get their tick now (unless we're asleep; they'll get a low energy update).
+        if (movement_state.refresh_granularity == MOVEMENT_REFRESH_PER_MINUTE && movement_state.le_mode_ticks != -1) {
+            _movement_queue_event(EVENT_TICK, 0);
+        }
+    }
+}
+
+static void _movement_program_alarm(void) {
+    // The RTC has a single alarm, and we always need it at the top of the minute. So if the soonest background task
+    // falls due before then, we match on its second instead; once it fires, we come back here and aim for the top of
+    // the minute again (or the next task in line).
+    watch_date_time_t now = watch_rtc_get_date_time();
+    watch_date_time_t alarm_time;
+    alarm_time.reg = 0;
+
+    if (_movement_task_queue_len) {
+        watch_date_time_t deadline = scheduled_tasks[_movement_task_queue[0]];
+        // the seconds live in the low six bits of the register, so everything above them identifies the minute.
+        if ((deadline.reg >> 6) == (now.reg >> 6)) alarm_time.unit.second = deadline.unit.second;
+    }
+
+    movement_state.alarm_second = alarm_time.unit.second;
+    watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
+
+    // if the deadline slipped by while we were setting up the alarm, the comparator won't catch it until this second
+    // comes around again next minute. flag it now so the next trip through the loop picks it up.
+    if (_movement_task_queue_len && scheduled_tasks[_movement_task_queue[0]].reg <= watch_rtc_get_date_time().reg) {
+        movement_state.background_task_due = true;
     }
+
+    // the same goes for the top of the minute: if second 0 went by before the alarm was aimed at it (after a slow
+    // background task, say), the alarm won't match until the next one. take it now; if the alarm did catch it after
+    // all, _movement_top_of_minute_reached knows not to take it twice.
+    watch_enter_critical_section();
+    _movement_top_of_minute_reached(watch_rtc_get_date_time());
+    watch_exit_critical_section();
 }
 
-static inline void _movement_disable_fast_tick_if_possible(void) {
-    if ((movement_state.light_ticks == -1) &&
-        (movement_state.alarm_ticks == -1) &&
-        ((movement_state.light_down_timestamp + movement_state.mode_down_timestamp + movement_state.alarm_down_timestamp) == 0)) {
-        movement_state.fast_tick_enabled = false;
-        watch_rtc_disable_periodic_callback(128);
+static void _movement_build_advise_dispatch_lists(void) {
+    _movement_advise_every_minute_len = 0;
+    _movement_advise_hourly_len = 0;
+    _movement_advise_timed_len = 0;
+    _movement_num_advising_faces = 0;
+
+    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        if (watch_faces[i].advise == NULL) continue;
+        _movement_num_advising_faces++;
+
+        switch (_movement_advise_interest[i]) {
+            case MOVEMENT_ADVISE_EVERY_MINUTE:
+                _movement_advise_every_minute[_movement_advise_every_minute_len++] = i;
+                break;
+            case MOVEMENT_ADVISE_HOURLY:
+                _movement_advise_hourly[_movement_advise_hourly_len++] = i;
+                break;
+            case MOVEMENT_ADVISE_AT_TIME: {
+                uint8_t j = _movement_advise_timed_len++;
+                while (j > 0 && _movement_advise_minute_of_day[_movement_advise_timed[j - 1]] > _movement_advise_minute_of_day[i]) {
+                    _movement_advise_timed[j] = _movement_advise_timed[j - 1];
+                    j--;
+                }
+                _movement_advise_timed[j] = i;
+                break;
+            }
+            case MOVEMENT_ADVISE_NEVER:
+                break;
+        }
     }
 }
 
+static void _movement_advise_face(uint8_t watch_face_index) {
+    _movement_ensure_face_setup(watch_face_index);
+    uint32_t start = _movement_stats_counter();
+    movement_watch_face_advisory_t advisory = watch_faces[watch_face_index].advise(watch_face_contexts[watch_face_index]);
+    _movement_face_stats[watch_face_index].active_us += _movement_stats_elapsed_us(start);
+    movement_state.advise_calls++;
+
+    // If it wants a background task...
+    if (advisory.wants_background_task) {
+        // we give it one. pretty straightforward!
+        movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+        _movement_call_face_loop(watch_face_index, background_event);
+    }
+
+    // TODO: handle other advisory types
+}
+
 static void _movement_handle_top_of_minute(void) {
     watch_date_time_t date_time = watch_rtc_get_date_time();
+    uint32_t advise_calls = movement_state.advise_calls;
+
+    // update the DST offset cache for any zone that just crossed a transition.
+    // frames drawn ahead of time are in the old local time, so they have to be drawn again.
+    if (_movement_handle_dst_transitions(date_time)) _movement_le_frames_count = 0;
 
-    // update the DST offset cache every 30 minutes, since someplace in the world could change.
-    if (date_time.unit.minute % 30 == 0) {
-        _movement_update_dst_offset_cache();
+    // sensor schedules and timed advice both go by local time. no need to work it out if nobody cares.
+    watch_date_time_t local_date_time = date_time;
+    if (_movement_num_sensor_subscriptions || _movement_advise_hourly_len || _movement_advise_timed_len) {
+        local_date_time = movement_get_local_date_time();
     }
 
-    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        // For each face that offers an advisory...
-        if (watch_faces[i].advise != NULL) {
-            // ...we ask for one.
-            movement_watch_face_advisory_t advisory = watch_faces[i].advise(watch_face_contexts[i]);
-
-            // If it wants a background task...
-            if (advisory.wants_background_task) {
-                // we give it one. pretty straightforward!
-                movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-                watch_faces[i].loop(background_event, watch_face_contexts[i]);
+    // take any scheduled sensor readings before the faces that asked for them are advised.
+    if (_movement_num_sensor_subscriptions) _movement_sample_scheduled_sensors(date_time, local_date_time);
+
+    // faces that want to hear from us every minute get asked every minute...
+    for(uint8_t i = 0; i < _movement_advise_every_minute_len; i++) {
+        _movement_advise_face(_movement_advise_every_minute[i]);
+    }
+
+    // ...while the rest only get asked when their time comes around.
+    if (_movement_advise_hourly_len || _movement_advise_timed_len) {
+        uint16_t minute_of_day = local_date_time.unit.hour * 60 + local_date_time.unit.minute;
+
+        if (local_date_time.unit.minute == 0) {
+            for(uint8_t i = 0; i < _movement_advise_hourly_len; i++) {
+                _movement_advise_face(_movement_advise_hourly[i]);
             }
+        }
 
-            // TODO: handle other advisory types
+        for(uint8_t i = 0; i < _movement_advise_timed_len; i++) {
+            uint16_t advise_minute_of_day = _movement_advise_minute_of_day[_movement_advise_timed[i]];
+            if (advise_minute_of_day > minute_of_day) break;
+            if (advise_minute_of_day == minute_of_day) _movement_advise_face(_movement_advise_timed[i]);
         }
     }
+
+    movement_state.advise_calls_skipped += _movement_num_advising_faces - (movement_state.advise_calls - advise_calls);
     movement_state.woke_from_alarm_handler = false;
+
+    // the alarm has just matched on second 0, so aim it at whatever comes next.
+    _movement_program_alarm();
 }
 
 static void _movement_handle_scheduled_tasks(void) {
     watch_date_time_t date_time = watch_rtc_get_date_time();
-    uint8_t num_active_tasks = 0;
-
-    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        if (scheduled_tasks[i].reg) {
-            if (scheduled_tasks[i].reg <= date_time.reg) {
-                scheduled_tasks[i].reg = 0;
-                movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-                watch_faces[i].loop(background_event, watch_face_contexts[i]);
-                // check if loop scheduled a new task
-                if (scheduled_tasks[i].reg) {
-                    num_active_tasks++;
-                }
-            } else {
-                num_active_tasks++;
-            }
-        }
+    movement_state.background_task_due = false;
+
+    // the queue is sorted, so we only ever have to look at the front of it.
+    while (_movement_task_queue_len && scheduled_tasks[_movement_task_queue[0]].reg <= date_time.reg) {
+        uint8_t watch_face_index = _movement_task_queue[0];
+        _movement_task_queue_remove(watch_face_index);
+        scheduled_tasks[watch_face_index].reg = 0;
+        movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+        // the face may schedule a new task from here; that lands in the queue strictly after date_time.
+        _movement_call_face_loop(watch_face_index, background_event);
     }
 
-    if (num_active_tasks == 0) {
-        movement_state.has_scheduled_background_task = false;
-    } else {
-        _movement_reset_inactivity_countdown();
+    movement_state.has_scheduled_background_task = (_movement_task_queue_len != 0);
+    _movement_program_alarm();
+}
+
+static void _movement_count_down_untimed_seconds(uint8_t second) {
+    // while the tick is off, nothing counts down to low energy mode or timeout. catch up on the seconds since we last
+    // did, where second is the current second (60 at the top of the minute).
+    if (second > movement_state.last_second) {
+        uint8_t elapsed = second - movement_state.last_second;
+        if (movement_state.le_mode_ticks > 0) movement_state.le_mode_ticks = (movement_state.le_mode_ticks > elapsed) ? movement_state.le_mode_ticks - elapsed : 0;
+        if (movement_state.timeout_ticks > 0) movement_state.timeout_ticks = (movement_state.timeout_ticks > elapsed) ? movement_state.timeout_ticks - elapsed : 0;
     }
+    movement_state.last_second = second % 60;
 }
 
 void movement_request_tick_frequency(uint8_t freq) {
@@ -212,38 +845,73 @@ void movement_request_tick_frequency(uint8_t freq) {
     // If we are asked for an invalid frequency, default back to 1 Hz.
     if (freq == 0 || __builtin_popcount(freq) != 1) freq = 1;
 
+    // if the tick was off, count the part of this minute that went by without it before handing back to cb_tick.
+    if (movement_state.refresh_granularity >= MOVEMENT_REFRESH_PER_MINUTE) {
+        _movement_count_down_untimed_seconds(watch_rtc_get_date_time().unit.second);
+    }
+
     // disable all callbacks except the 128 Hz one
     watch_rtc_disable_matching_periodic_callbacks(0xFE);
 
     movement_state.subsecond = 0;
     movement_state.tick_frequency = freq;
+    movement_state.refresh_granularity = (freq > 1) ? MOVEMENT_REFRESH_SUBSECOND : MOVEMENT_REFRESH_PER_SECOND;
     watch_rtc_register_periodic_callback(cb_tick, freq);
 }
 
+void movement_request_refresh_granularity(movement_refresh_granularity_t granularity) {
+    switch (granularity) {
+        case MOVEMENT_REFRESH_PER_SECOND:
+            movement_request_tick_frequency(1);
+            break;
+        case MOVEMENT_REFRESH_SUBSECOND:
+            // keep whatever fast rate the face already asked for; otherwise start at 2 Hz.
+            movement_request_tick_frequency(movement_state.tick_frequency > 1 ? movement_state.tick_frequency : 2);
+            break;
+        case MOVEMENT_REFRESH_PER_MINUTE:
+        case MOVEMENT_REFRESH_EVENT_ONLY:
+            // turn off the tick altogether; the minute alarm and background task deadlines will wake us.
+            watch_rtc_disable_matching_periodic_callbacks(0xFE);
+            // the tick was also counting down to low energy mode and timeout. from here on, the alarm handler does that
+            // at the top of each minute, so note how far into this minute the tick got. if the tick was already off,
+            // last_second still marks where counting left off, and must not move.
+            if (movement_state.refresh_granularity < MOVEMENT_REFRESH_PER_MINUTE) {
+                movement_state.last_second = watch_rtc_get_date_time().unit.second;
+            }
+            movement_state.subsecond = 0;
+            movement_state.tick_frequency = 0;
+            movement_state.refresh_granularity = granularity;
+            break;
+    }
+}
+
 void movement_illuminate_led(void) {
     if (movement_state.settings.bit.led_duration != 0b111) {
         watch_set_led_color_rgb(movement_state.settings.bit.led_red_color | movement_state.settings.bit.led_red_color << 4,
                                 movement_state.settings.bit.led_green_color | movement_state.settings.bit.led_green_color << 4,
                                 movement_state.settings.bit.led_blue_color | movement_state.settings.bit.led_blue_color << 4);
         if (movement_state.settings.bit.led_duration == 0) {
-            movement_state.light_ticks = 1;
+            // no timeout; app_loop will keep it on for as long as the light button is held.
+            movement_state.light_state = MOVEMENT_LIGHT_EXPIRED;
+            _movement_clear_deadline_from_foreground(MOVEMENT_DEADLINE_LED_OFF);
         } else {
-            movement_state.light_ticks = (movement_state.settings.bit.led_duration * 2 - 1) * 128;
+            movement_state.light_state = MOVEMENT_LIGHT_TIMED;
+            _movement_set_deadline_from_foreground(MOVEMENT_DEADLINE_LED_OFF, (movement_state.settings.bit.led_duration * 2 - 1) * WATCH_TIMER_TICKS_PER_SECOND);
         }
-        _movement_enable_fast_tick_if_needed();
     }
 }
 
 void movement_force_led_on(uint8_t red, uint8_t green, uint8_t blue) {
     // this is hacky, we need a way for watch faces to set an arbitrary color and prevent Movement from turning it right back off.
     watch_set_led_color_rgb(red, green, blue);
-    movement_state.light_ticks = 32767;
+    movement_state.light_state = MOVEMENT_LIGHT_FORCED_ON;
+    _movement_clear_deadline_from_foreground(MOVEMENT_DEADLINE_LED_OFF);
 }
 
 void movement_force_led_off(void) {
     watch_set_led_off();
-    movement_state.light_ticks = -1;
-    _movement_disable_fast_tick_if_possible();
+    movement_state.light_state = MOVEMENT_LIGHT_OFF;
+    _movement_clear_deadline_from_foreground(MOVEMENT_DEADLINE_LED_OFF);
 }
 
 bool movement_default_loop_handler(movement_event_t event) {
@@ -299,21 +967,35 @@ void movement_cancel_background_task(void) {
 void movement_schedule_background_task_for_face(uint8_t watch_face_index, watch_date_time_t date_time) {
     watch_date_time_t now = watch_rtc_get_date_time();
     if (date_time.reg > now.reg) {
-        movement_state.has_scheduled_background_task = true;
+        if (scheduled_tasks[watch_face_index].reg) _movement_task_queue_remove(watch_face_index);
         scheduled_tasks[watch_face_index].reg = date_time.reg;
+        _movement_task_queue_insert(watch_face_index);
+        movement_state.has_scheduled_background_task = true;
+        // only the front of the queue matters to the alarm.
+        if (_movement_task_queue[0] == watch_face_index) _movement_program_alarm();
     }
 }
 
 void movement_cancel_background_task_for_face(uint8_t watch_face_index) {
+    if (scheduled_tasks[watch_face_index].reg == 0) return;
+
+    bool was_next = (_movement_task_queue[0] == watch_face_index);
+    _movement_task_queue_remove(watch_face_index);
     scheduled_tasks[watch_face_index].reg = 0;
-    bool other_tasks_scheduled = false;
-    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        if (scheduled_tasks[i].reg != 0) {
-            other_tasks_scheduled = true;
-            break;
-        }
-    }
-    movement_state.has_scheduled_background_task = other_tasks_scheduled;
+    movement_state.has_scheduled_background_task = (_movement_task_queue_len != 0);
+    if (was_next) _movement_program_alarm();
+}
+
+void movement_set_advise_interest(uint8_t watch_face_index, movement_advise_interest_t interest, uint8_t hour, uint8_t minute) {
+    _movement_advise_interest[watch_face_index] = interest;
+    _movement_advise_minute_of_day[watch_face_index] = hour * 60 + minute;
+    _movement_build_advise_dispatch_lists();
+}
+
+void movement_set_low_energy_prerender(uint8_t watch_face_index, bool prerender) {
+    if (_movement_le_prerender[watch_face_index] == prerender) return;
+    _movement_le_prerender[watch_face_index] = prerender;
+    _movement_le_frames_count = 0;
 }
 
 void movement_request_sleep(void) {
@@ -350,9 +1032,8 @@ void movement_play_signal(void) {
     watch_buzzer_play_sequence(signal_tune, maybe_disable_buzzer);
     if (movement_state.le_mode_ticks == -1) {
         // the watch is asleep. wake it up for "1" round through the main loop.
-        // the sleep_mode_app_loop will notice the is_buzzing and note that it
-        // only woke up to beep and then it will spinlock until the callback
-        // turns off the is_buzzing flag.
+        // the sequence keeps playing in standby, and app_loop won't go back
+        // into low energy mode until the callback turns off the is_buzzing flag.
         movement_state.needs_wake = true;
         movement_state.le_mode_ticks = 1;
     }
@@ -362,14 +1043,54 @@ void movement_play_alarm(void) {
     movement_play_alarm_beeps(5, BUZZER_NOTE_C8);
 }
 
+static void _movement_alarm_finished(bool disable_buzzer) {
+    movement_state.is_alarm_playing = false;
+    movement_state.is_buzzing = false;
+    if (disable_buzzer) watch_disable_buzzer();
+    _movement_queue_event(EVENT_ALARM_FINISHED, movement_state.subsecond);
+}
+
+static void end_alarm(void) {
+    _movement_alarm_finished(false);
+}
+
+static void end_alarm_and_disable_buzzer(void) {
+    _movement_alarm_finished(true);
+}
+
 void movement_play_alarm_beeps(uint8_t rounds, watch_buzzer_note_t alarm_note) {
+    // four beeps and a pause, once a second. the sequence advances at 64 Hz, and each note lasts one tick longer than its duration.
+    static int8_t alarm_tune[] = {
+        BUZZER_NOTE_C8, 2,
+        BUZZER_NOTE_REST, 2,
+        BUZZER_NOTE_C8, 2,
+        BUZZER_NOTE_REST, 2,
+        BUZZER_NOTE_C8, 2,
+        BUZZER_NOTE_REST, 2,
+        BUZZER_NOTE_C8, 4,
+        BUZZER_NOTE_REST, 40,
+        -8, 0,
+        0
+    };
+    void (*maybe_disable_buzzer)(void) = end_alarm_and_disable_buzzer;
+
     if (rounds == 0) rounds = 1;
     if (rounds > 20) rounds = 20;
     movement_request_wake();
-    movement_state.alarm_note = alarm_note;
-    // our tone is 0.375 seconds of beep and 0.625 of silence, repeated as given.
-    movement_state.alarm_ticks = 128 * rounds - 75;
-    _movement_enable_fast_tick_if_needed();
+
+    for (uint8_t i = 0; i < 16; i += 4) alarm_tune[i] = alarm_note;
+    // the round plays once, and then the repeat marker plays it this many more times.
+    alarm_tune[17] = rounds - 1;
+
+    // if the LED is holding the TCC on, leave it on when we're done, the same as movement_play_signal does.
+    if (!movement_state.is_alarm_playing && watch_is_buzzer_or_led_enabled()) {
+        maybe_disable_buzzer = end_alarm;
+    } else {
+        watch_enable_buzzer();
+    }
+    movement_state.is_alarm_playing = true;
+    movement_state.is_buzzing = true;
+    watch_buzzer_play_sequence(alarm_tune, maybe_disable_buzzer);
 }
 
 uint8_t movement_claim_backup_register(void) {
@@ -411,6 +1132,7 @@ watch_date_time_t movement_get_date_time_in_zone(uint8_t zone_index) {
 }
 
 watch_date_time_t movement_get_local_date_time(void) {
+    if (_movement_le_rendering) return _movement_le_render_time;
     watch_date_time_t date_time = watch_rtc_get_date_time();
     return watch_utility_date_time_convert_zone(date_time, 0, movement_get_current_timezone_offset());
 }
@@ -424,6 +1146,11 @@ void movement_set_local_date_time(watch_date_time_t date_time) {
     // they may have just crossed a DST boundary, which means the next call to this function
     // could require a different offset to force local time back to UTC. Quelle horreur!
     _movement_update_dst_offset_cache();
+
+    // the clock just jumped, so whatever second the alarm was aimed at may no longer be the right one. and the minute we
+    // jumped to hasn't had a top of the minute that we missed; it will get one at the next second 0.
+    _movement_last_minute_reached = watch_rtc_get_date_time().reg >> 6;
+    _movement_program_alarm();
 }
 
 bool movement_button_should_sound(void) {
@@ -497,11 +1224,36 @@ void movement_set_backlight_dwell(uint8_t value) {
 }
 
 void movement_store_settings(void) {
-    movement_settings_t old_settings;
-    filesystem_read_file("settings.u32", (char *)&old_settings, sizeof(movement_settings_t));
-    if (movement_state.settings.reg != old_settings.reg) {
-        filesystem_write_file("settings.u32", (char *)&movement_state.settings, sizeof(movement_settings_t));
-    }
+    watch_store_backup_data(movement_state.settings.reg, MOVEMENT_SETTINGS_BACKUP_REGISTER);
+    _movement_settings_dirty = true;
+}
+
+movement_location_t movement_get_location(void) {
+    movement_location_t location;
+    location.reg = watch_get_backup_data(MOVEMENT_LOCATION_BACKUP_REGISTER);
+    return location;
+}
+
+void movement_set_location(movement_location_t location) {
+    if (location.reg == watch_get_backup_data(MOVEMENT_LOCATION_BACKUP_REGISTER)) return;
+    watch_store_backup_data(location.reg, MOVEMENT_LOCATION_BACKUP_REGISTER);
+    _movement_location_dirty = true;
+}
+
+static void _movement_flush_backup_register(char *filename, uint8_t reg, volatile bool *dirty) {
+    if (!*dirty) return;
+    *dirty = false;
+
+    // a file that already says the same thing doesn't need the write, or the erase that comes with it.
+    uint32_t value = watch_get_backup_data(reg);
+    uint32_t old_value = 0;
+    if (filesystem_file_exists(filename)) filesystem_read_file(filename, (char *)&old_value, sizeof(old_value));
+    if (value != old_value) filesystem_write_file(filename, (char *)&value, sizeof(value));
+}
+
+static void _movement_flush_settings(void) {
+    _movement_flush_backup_register("settings.u32", MOVEMENT_SETTINGS_BACKUP_REGISTER, &_movement_settings_dirty);
+    _movement_flush_backup_register("location.u32", MOVEMENT_LOCATION_BACKUP_REGISTER, &_movement_location_dirty);
 }
 
 bool movement_alarm_enabled(void) {
@@ -586,7 +1338,95 @@ bool movement_set_accelerometer_motion_threshold(uint8_t new_threshold) {
     return false;
 }
 
-float movement_get_temperature(void) {
+void *movement_alloc_face_context(size_t size) {
+    size_t rounded = MOVEMENT_FACE_CONTEXT_BYTES(size);
+    movement_face_memory_t *memory = (_movement_face_in_setup >= 0) ? &_movement_face_memory[_movement_face_in_setup] : NULL;
+
+    if (rounded > MOVEMENT_FACE_ARENA_SIZE - _movement_face_arena_used) {
+        // the build checks that the configured faces fit, so only an allocation made outside of setup can get here.
+        printf("face %d: %u bytes won't fit in the face arena\r\n", _movement_face_in_setup, (unsigned)size);
+        abort();
+    }
+
+    void *context = &_movement_face_arena[_movement_face_arena_used];
+    _movement_face_arena_used += rounded;
+    if (memory) memory->arena_bytes += rounded;
+
+    return context;
+}
+
+const movement_face_memory_t *movement_get_face_memory(uint8_t watch_face_index) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return NULL;
+    return &_movement_face_memory[watch_face_index];
+}
+
+size_t movement_get_face_arena_used(void) {
+    return _movement_face_arena_used;
+}
+
+size_t movement_get_face_arena_size(void) {
+    return MOVEMENT_FACE_ARENA_SIZE;
+}
+
+void movement_print_face_memory(void) {
+    printf("face contexts: %u of %u bytes\r\n", (unsigned)_movement_face_arena_used, (unsigned)MOVEMENT_FACE_ARENA_SIZE);
+    for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        const movement_face_memory_t *memory = &_movement_face_memory[i];
+        if (memory->arena_bytes) {
+            printf("  face %u: %u bytes\r\n", i, memory->arena_bytes);
+        }
+    }
+}
+
+uint8_t movement_get_current_face_index(void) {
+    return movement_state.current_face_idx;
+}
+
+const movement_face_stats_t *movement_get_face_stats(uint8_t watch_face_index) {
+    if (watch_face_index >= MOVEMENT_NUM_FACES) return NULL;
+    return &_movement_face_stats[watch_face_index];
+}
+
+void movement_reset_face_stats(void) {
+    memset(_movement_face_stats, 0, sizeof(_movement_face_stats));
+    movement_state.advise_calls = 0;
+    movement_state.advise_calls_skipped = 0;
+    movement_state.event_queue_overflows = 0;
+}
+
+uint32_t movement_get_advise_calls(void) {
+    return movement_state.advise_calls;
+}
+
+uint32_t movement_get_advise_calls_skipped(void) {
+    return movement_state.advise_calls_skipped;
+}
+
+uint16_t movement_get_event_queue_overflows(void) {
+    return movement_state.event_queue_overflows;
+}
+
+uint32_t movement_get_last_wake_latency_us(void) {
+    return _movement_last_wake_latency_us;
+}
+
+uint16_t movement_get_wake_trace_length(void) {
+    return _movement_wake_trace.length;
+}
+
+const movement_wake_trace_entry_t *movement_get_wake_trace_entry(uint16_t index) {
+    if (index >= _movement_wake_trace.length) return NULL;
+    uint16_t oldest = (_movement_wake_trace.head + MOVEMENT_WAKE_TRACE_LENGTH - _movement_wake_trace.length) % MOVEMENT_WAKE_TRACE_LENGTH;
+    return &_movement_wake_trace.entries[(oldest + index) % MOVEMENT_WAKE_TRACE_LENGTH];
+}
+
+void movement_clear_wake_trace(void) {
+    _movement_wake_trace.magic = MOVEMENT_WAKE_TRACE_MAGIC;
+    _movement_wake_trace.head = 0;
+    _movement_wake_trace.length = 0;
+}
+
+static float _movement_sample_temperature(void) {
     float temperature_c = (float)0xFFFFFFFF;
 
     if (movement_state.has_thermistor) {
@@ -594,17 +1434,103 @@ float movement_get_temperature(void) {
         temperature_c = thermistor_driver_get_temperature();
         thermistor_driver_disable();
     } else if (movement_state.has_lis2dw) {
-            int16_t val = lis2dw_get_temperature();
-            val = val >> 4;
-            temperature_c = 25 + (float)val / 16.0;
+        int16_t val = lis2dw_get_temperature();
+        val = val >> 4;
+        temperature_c = 25 + (float)val / 16.0;
     }
 
     return temperature_c;
 }
 
+static float _movement_sample_sensor(movement_sensor_t sensor, uint32_t now) {
+    movement_sensor_reading_t *reading = &_movement_sensor_readings[sensor];
+
+    switch (sensor) {
+        case MOVEMENT_SENSOR_TEMPERATURE:
+            reading->value = _movement_sample_temperature();
+            break;
+        case MOVEMENT_SENSOR_VCC:
+            reading->value = watch_get_vcc_voltage();
+            break;
+        default:
+            return 0;
+    }
+    reading->taken_at = now;
+
+    return reading->value;
+}
+
+static float _movement_get_sensor_reading(movement_sensor_t sensor, uint32_t now, uint32_t max_age) {
+    movement_sensor_reading_t *reading = &_movement_sensor_readings[sensor];
+
+    // if the clock went backwards, now - taken_at wraps around and we take a new reading, which is what we want.
+    if (reading->taken_at == 0 || now - reading->taken_at > max_age) return _movement_sample_sensor(sensor, now);
+
+    return reading->value;
+}
+
+static inline uint32_t _movement_sensor_now(void) {
+    return watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+}
+
+float movement_get_temperature(void) {
+    return _movement_sample_sensor(MOVEMENT_SENSOR_TEMPERATURE, _movement_sensor_now());
+}
+
+uint16_t movement_get_vcc_voltage(void) {
+    return _movement_sample_sensor(MOVEMENT_SENSOR_VCC, _movement_sensor_now());
+}
+
+float movement_get_temperature_no_older_than(uint32_t max_age) {
+    return _movement_get_sensor_reading(MOVEMENT_SENSOR_TEMPERATURE, _movement_sensor_now(), max_age);
+}
+
+uint16_t movement_get_vcc_voltage_no_older_than(uint32_t max_age) {
+    return _movement_get_sensor_reading(MOVEMENT_SENSOR_VCC, _movement_sensor_now(), max_age);
+}
+
+float movement_get_cached_temperature(void) {
+    return movement_get_temperature_no_older_than(MOVEMENT_SENSOR_MAX_AGE);
+}
+
+uint16_t movement_get_cached_vcc_voltage(void) {
+    return movement_get_vcc_voltage_no_older_than(MOVEMENT_SENSOR_MAX_AGE);
+}
+
+void movement_set_sensor_interest(uint8_t watch_face_index, movement_sensor_t sensor, uint8_t interval_minutes) {
+    if (sensor >= MOVEMENT_NUM_SENSORS) return;
+    if (_movement_sensor_interest[sensor][watch_face_index]) _movement_num_sensor_subscriptions--;
+    if (interval_minutes) _movement_num_sensor_subscriptions++;
+    _movement_sensor_interest[sensor][watch_face_index] = interval_minutes;
+}
+
+static void _movement_sample_scheduled_sensors(watch_date_time_t date_time, watch_date_time_t local_date_time) {
+    uint32_t now = watch_utility_date_time_to_unix_time(date_time, 0);
+    // intervals count from local midnight, like the times faces ask to be advised at.
+    uint16_t minute_of_day = local_date_time.unit.hour * 60 + local_date_time.unit.minute;
+
+    for (uint8_t sensor = 0; sensor < MOVEMENT_NUM_SENSORS; sensor++) {
+        for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+            uint8_t interval = _movement_sensor_interest[sensor][i];
+            if (interval && minute_of_day % interval == 0) {
+                // one reading serves everyone who wanted one this minute.
+                _movement_get_sensor_reading(sensor, now, 0);
+                break;
+            }
+        }
+    }
+}
+
 void app_init(void) {
     _watch_init();
 
+    // keep the wake trace from before a soft reset, if there is one.
+    if (_movement_wake_trace.magic != MOVEMENT_WAKE_TRACE_MAGIC ||
+        _movement_wake_trace.head >= MOVEMENT_WAKE_TRACE_LENGTH ||
+        _movement_wake_trace.length > MOVEMENT_WAKE_TRACE_LENGTH) {
+        movement_clear_wake_trace();
+    }
+
     filesystem_init();
 
     // check if we are plugged into USB power.
@@ -621,15 +1547,38 @@ void app_init(void) {
 
     movement_state.has_thermistor = thermistor_driver_init();
 
-    bool settings_file_exists = filesystem_file_exists("settings.u32");
+#if !__EMSCRIPTEN__ && !WATCH_POSIX
+    // free-running SysTick (no interrupt) for timing face callbacks.
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+#endif
+
+    // the backup registers come through anything but a loss of power, and if they made it, they may have changes
+    // that never got to flash. if not, the flash copy is the latest we have.
     movement_settings_t maybe_settings;
-    if (settings_file_exists && maybe_settings.bit.version == 0) {
+    bool settings_found = false;
+    maybe_settings.reg = watch_get_backup_data(MOVEMENT_SETTINGS_BACKUP_REGISTER);
+    if (maybe_settings.reg != 0 && maybe_settings.bit.version == 0) {
+        settings_found = true;
+        _movement_settings_dirty = true;
+    } else if (filesystem_file_exists("settings.u32")) {
         filesystem_read_file("settings.u32", (char *) &maybe_settings, sizeof(movement_settings_t));
+        settings_found = maybe_settings.bit.version == 0;
     }
 
-    if (settings_file_exists && maybe_settings.bit.version == 0) {
+    if (watch_get_backup_data(MOVEMENT_LOCATION_BACKUP_REGISTER) != 0) {
+        _movement_location_dirty = true;
+    } else if (filesystem_file_exists("location.u32")) {
+        movement_location_t location = {0};
+        filesystem_read_file("location.u32", (char *) &location.reg, sizeof(movement_location_t));
+        watch_store_backup_data(location.reg, MOVEMENT_LOCATION_BACKUP_REGISTER);
+    }
+
+    if (settings_found) {
         // If settings file exists and has a valid version, restore it!
         movement_state.settings.reg = maybe_settings.reg;
+        watch_store_backup_data(movement_state.settings.reg, MOVEMENT_SETTINGS_BACKUP_REGISTER);
     } else {
         // Otherwise set default values.
         movement_state.settings.bit.version = 0;
@@ -679,8 +1628,7 @@ void app_init(void) {
 
     if (movement_state.accelerometer_motion_threshold == 0) movement_state.accelerometer_motion_threshold = 32;
 
-    movement_state.light_ticks = -1;
-    movement_state.alarm_ticks = -1;
+    movement_state.light_state = MOVEMENT_LIGHT_OFF;
     movement_state.next_available_backup_register = 2;
     _movement_reset_inactivity_countdown();
 }
@@ -688,9 +1636,52 @@ void app_init(void) {
 void app_wake_from_backup(void) {
 }
 
-void app_setup(void) {
-    watch_store_backup_data(movement_state.settings.reg, 0);
+#ifdef I2C_SERCOM
+// one-time configuration of the accelerometer after it has been detected and reset at boot.
+static void _movement_configure_lis2dw(void) {
+    lis2dw_set_mode(LIS2DW_MODE_LOW_POWER);         // select low power (not high performance) mode
+    lis2dw_set_low_power_mode(LIS2DW_LP_MODE_1);    // lowest power mode, 12-bit
+    lis2dw_set_low_noise_mode(false);               // low noise mode raises power consumption slightly; we don't need it
+    lis2dw_enable_stationary_motion_detection();    // stationary/motion detection mode keeps the data rate at 1.6 Hz even in sleep
+    lis2dw_set_range(LIS2DW_RANGE_2_G);             // Application note AN5038 recommends 2g range
+    lis2dw_enable_sleep();                          // allow acceleromter to sleep and wake on activity
+    lis2dw_configure_wakeup_threshold(movement_state.accelerometer_motion_threshold); // g threshold to wake up: (THS * FS / 64) where FS is "full scale" of ±2g.
+    lis2dw_configure_6d_threshold(3);               // 0-3 is 80, 70, 60, or 50 degrees. 50 is least precise, hopefully most sensitive?
+
+    // set up interrupts:
+    // INT1 is wired to pin A3. We'll configure the accelerometer to output an interrupt on INT1 when it detects an orientation change.
+    /// TODO: We had routed this interrupt to TC2 to count orientation changes, but TC2 consumed too much power.
+    /// Orientation changes helped with sleep tracking; would love to bring this back if we can find a low power solution.
+    /// For now, commenting these lines out; check commit 27f0c629d865f4bc56bc6e678da1eb8f4b919093 for power-hungry but working code.
+    // lis2dw_configure_int1(LIS2DW_CTRL4_INT1_6D);
+    // HAL_GPIO_A3_in();
+
+    // next: INT2 is wired to pin A4. We'll configure the accelerometer to output the sleep state on INT2.
+    // a falling edge on INT2 indicates the accelerometer has woken up.
+    lis2dw_configure_int2(LIS2DW_CTRL5_INT2_SLEEP_STATE | LIS2DW_CTRL5_INT2_SLEEP_CHG);
+    HAL_GPIO_A4_in();
+
+    // Wake on motion seemed like a good idea when the threshold was lower, but the UX makes less sense now.
+    // Still if you want to wake on motion, you can do it by uncommenting this line:
+    // watch_register_extwake_callback(HAL_GPIO_A4_pin(), cb_accelerometer_wake, false);
+
+    // later on, we are going to use INT1 for tap detection. We'll set up that interrupt here,
+    // but it will only fire once tap recognition is enabled.
+    watch_register_interrupt_callback(HAL_GPIO_A3_pin(), cb_accelerometer_event, INTERRUPT_TRIGGER_RISING);
+
+    // Enable the interrupts...
+    lis2dw_enable_interrupts();
+
+    // At first boot, this next line sets the accelerometer's sampling rate to 0, which is LIS2DW_DATA_RATE_POWERDOWN.
+    // This means the interrupts we just configured won't fire.
+    // Tap detection will ramp up sesing and make use of the A3 interrupt.
+    // If a watch face wants to check in on the A4 interrupt pin for motion status, it can call
+    // movement_set_accelerometer_background_rate with another rate like LIS2DW_DATA_RATE_LOWEST or LIS2DW_DATA_RATE_25_HZ.
+    lis2dw_set_data_rate(movement_state.accelerometer_background_rate);
+}
+#endif
 
+void app_setup(void) {
     static bool is_first_launch = true;
 
     if (is_first_launch) {
@@ -701,8 +1692,11 @@ void app_setup(void) {
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
             watch_face_contexts[i] = NULL;
             scheduled_tasks[i].reg = 0;
+            // until a face tells us otherwise, an advise function means it wants to be asked every minute.
+            _movement_advise_interest[i] = MOVEMENT_ADVISE_EVERY_MINUTE;
             is_first_launch = false;
         }
+        _movement_build_advise_dispatch_lists();
 
 #if __EMSCRIPTEN__
         int32_t time_zone_offset = EM_ASM_INT({
@@ -716,10 +1710,9 @@ void app_setup(void) {
         }
 #endif
 
-        // set up the 1 minute alarm (for background tasks and low power updates)
-        watch_date_time_t alarm_time;
-        alarm_time.reg = 0;
-        watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
+        // set up the 1 minute alarm (for background tasks and low power updates), starting with the next minute.
+        _movement_last_minute_reached = watch_rtc_get_date_time().reg >> 6;
+        _movement_program_alarm();
     }
 
     // LCD autodetect uses the buttons as a a failsafe, so we should run it before we enable the button interrupts
@@ -744,83 +1737,116 @@ void app_setup(void) {
                 watch_disable_i2c();
             }
             lis2dw_checked = true;
+
+            if (movement_state.has_lis2dw) _movement_configure_lis2dw();
         } else if (movement_state.has_lis2dw) {
+            // the accelerometer stays powered and keeps its configuration while we sleep; we only have to
+            // restore our own side of the connection, since sleep mode turned off the pins.
             watch_enable_i2c();
-            lis2dw_begin();
-        }
-
-        if (movement_state.has_lis2dw) {
-            lis2dw_set_mode(LIS2DW_MODE_LOW_POWER);         // select low power (not high performance) mode
-            lis2dw_set_low_power_mode(LIS2DW_LP_MODE_1);    // lowest power mode, 12-bit
-            lis2dw_set_low_noise_mode(false);               // low noise mode raises power consumption slightly; we don't need it
-            lis2dw_enable_stationary_motion_detection();    // stationary/motion detection mode keeps the data rate at 1.6 Hz even in sleep
-            lis2dw_set_range(LIS2DW_RANGE_2_G);             // Application note AN5038 recommends 2g range
-            lis2dw_enable_sleep();                          // allow acceleromter to sleep and wake on activity
-            lis2dw_configure_wakeup_threshold(movement_state.accelerometer_motion_threshold); // g threshold to wake up: (THS * FS / 64) where FS is "full scale" of ±2g.
-            lis2dw_configure_6d_threshold(3);               // 0-3 is 80, 70, 60, or 50 degrees. 50 is least precise, hopefully most sensitive?
-
-            // set up interrupts:
-            // INT1 is wired to pin A3. We'll configure the accelerometer to output an interrupt on INT1 when it detects an orientation change.
-            /// TODO: We had routed this interrupt to TC2 to count orientation changes, but TC2 consumed too much power.
-            /// Orientation changes helped with sleep tracking; would love to bring this back if we can find a low power solution.
-            /// For now, commenting these lines out; check commit 27f0c629d865f4bc56bc6e678da1eb8f4b919093 for power-hungry but working code.
-            // lis2dw_configure_int1(LIS2DW_CTRL4_INT1_6D);
-            // HAL_GPIO_A3_in();
-
-            // next: INT2 is wired to pin A4. We'll configure the accelerometer to output the sleep state on INT2.
-            // a falling edge on INT2 indicates the accelerometer has woken up.
-            lis2dw_configure_int2(LIS2DW_CTRL5_INT2_SLEEP_STATE | LIS2DW_CTRL5_INT2_SLEEP_CHG);
             HAL_GPIO_A4_in();
-
-            // Wake on motion seemed like a good idea when the threshold was lower, but the UX makes less sense now.
-            // Still if you want to wake on motion, you can do it by uncommenting this line:
-            // watch_register_extwake_callback(HAL_GPIO_A4_pin(), cb_accelerometer_wake, false);
-
-            // later on, we are going to use INT1 for tap detection. We'll set up that interrupt here,
-            // but it will only fire once tap recognition is enabled.
             watch_register_interrupt_callback(HAL_GPIO_A3_pin(), cb_accelerometer_event, INTERRUPT_TRIGGER_RISING);
-
-            // Enable the interrupts...
-            lis2dw_enable_interrupts();
-
-            // At first boot, this next line sets the accelerometer's sampling rate to 0, which is LIS2DW_DATA_RATE_POWERDOWN.
-            // This means the interrupts we just configured won't fire.
-            // Tap detection will ramp up sesing and make use of the A3 interrupt.
-            // If a watch face wants to check in on the A4 interrupt pin for motion status, it can call
-            // movement_set_accelerometer_background_rate with another rate like LIS2DW_DATA_RATE_LOWEST or LIS2DW_DATA_RATE_25_HZ.
-            lis2dw_set_data_rate(movement_state.accelerometer_background_rate);
         }
 #endif
 
         watch_enable_buzzer();
         watch_enable_leds();
 
+        // if we're waking from low energy mode, the wake interrupt has just reset the inactivity countdowns, and the
+        // seconds we spent asleep don't count against them. start counting from now, so that turning the tick back on
+        // doesn't catch up on seconds from before we slept.
+        movement_state.last_second = watch_rtc_get_date_time().unit.second;
         movement_request_tick_frequency(1);
 
+        static bool faces_initialized = false;
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-            watch_faces[i].setup(i, &watch_face_contexts[i]);
+            if (faces_initialized) {
+                // waking from low energy mode: every face gets its setup call again, but only when we next
+                // call into it. most faces won't be touched before the next sleep, so that keeps the wake path short.
+                _movement_face_needs_setup[i] = true;
+            } else {
+                _movement_call_face_setup(i);
+            }
         }
+        if (!faces_initialized) movement_print_face_memory();
+        faces_initialized = true;
 
+        _movement_ensure_face_setup(movement_state.current_face_idx);
         watch_faces[movement_state.current_face_idx].activate(watch_face_contexts[movement_state.current_face_idx]);
-        event.subsecond = 0;
-        event.event_type = EVENT_ACTIVATE;
+        _movement_activate_pending = true;
     }
 }
 
 #ifndef MOVEMENT_LOW_ENERGY_MODE_FORBIDDEN
 
+static void _movement_render_low_energy_frames(uint32_t utc_minute) {
+    movement_event_t event = { EVENT_LOW_ENERGY_UPDATE, 0 };
+    int32_t utc_offset = movement_get_current_timezone_offset();
+
+    // each frame starts from the one before it, just as each update would start from what was already on screen.
+    watch_display_capture_frame(&_movement_le_frames[0]);
+    _movement_le_rendering = true;
+    for (uint8_t i = 0; i < MOVEMENT_LOW_ENERGY_FRAMES; i++) {
+        if (i) _movement_le_frames[i] = _movement_le_frames[i - 1];
+        _movement_le_render_time = watch_utility_date_time_from_unix_time((utc_minute + i) * 60, utc_offset);
+        watch_display_draw_into_frame(&_movement_le_frames[i]);
+        _movement_call_face_loop(movement_state.current_face_idx, event);
+    }
+    watch_display_draw_into_frame(NULL);
+    _movement_le_rendering = false;
+
+    _movement_le_frames_start = utc_minute;
+    _movement_le_frames_count = MOVEMENT_LOW_ENERGY_FRAMES;
+}
+
+static void _movement_update_low_energy_display(void) {
+    if (!_movement_le_prerender[movement_state.current_face_idx]) {
+        movement_event_t event = { EVENT_LOW_ENERGY_UPDATE, 0 };
+        _movement_call_face_loop(movement_state.current_face_idx, event);
+        return;
+    }
+
+    // if we've run out of frames, or the time has been changed out from under them, draw some more.
+    uint32_t utc_minute = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0) / 60;
+    if (utc_minute - _movement_le_frames_start >= _movement_le_frames_count) _movement_render_low_energy_frames(utc_minute);
+    watch_display_show_frame(&_movement_le_frames[utc_minute - _movement_le_frames_start]);
+}
+
 static void _sleep_mode_app_loop(void) {
+    bool should_update_display = true;
     movement_state.needs_wake = false;
+    // whatever we drew the last time we were here has been drawn over since.
+    _movement_le_frames_count = 0;
+    // once, before any updates, so that a face that draws ahead of time has somewhere to start its animations.
+    movement_event_t event = { EVENT_LOW_ENERGY_BEGIN, 0 };
+    _movement_call_face_loop(movement_state.current_face_idx, event);
     // as long as le_mode_ticks is -1 (i.e. we are in low energy mode), we wake up here, update the screen, and go right back to sleep.
     while (movement_state.le_mode_ticks == -1) {
+        uint32_t wake_started_at = _movement_stats_counter();
+        _movement_wake_trace_begin();
+
         // we also have to handle top-of-the-minute tasks here in the mini-runloop
-        if (movement_state.woke_from_alarm_handler) _movement_handle_top_of_minute();
+        if (movement_state.woke_from_alarm_handler) {
+            _movement_handle_top_of_minute();
+            should_update_display = true;
+        }
+
+        // ...as well as any background task whose deadline woke us up.
+        if (movement_state.background_task_due) _movement_handle_scheduled_tasks();
+
+        // the display only changes once a minute in this mode, so a wake that was just for a background task leaves it alone.
+        if (should_update_display) {
+            _movement_update_low_energy_display();
+            watch_display_commit();
+            should_update_display = false;
+        }
 
-        event.event_type = EVENT_LOW_ENERGY_UPDATE;
-        watch_faces[movement_state.current_face_idx].loop(event, watch_face_contexts[movement_state.current_face_idx]);
+        _movement_wake_trace_count(wake_started_at);
+        _movement_wake_trace_end();
 
         // if we need to wake immediately, do it!
         if (movement_state.needs_wake) return;
+        // if a minute or a background task came due while we were busy, handle it before going back to sleep.
+        else if (movement_state.woke_from_alarm_handler || movement_state.background_task_due) continue;
         // otherwise enter sleep mode, and when the extwake handler is called, it will reset le_mode_ticks and force us out at the next loop.
         else watch_enter_sleep_mode();
     }
@@ -828,9 +1854,29 @@ static void _sleep_mode_app_loop(void) {
 
 #endif
 
+static bool _movement_woke_for_nothing(void) {
+    // the display's segment blinks and animations interrupt us at each step, but the interrupt has already rewritten
+    // the few SLCD registers involved. unless something Movement listens for went off too, there's nothing to do.
+    return _movement_slept_after_last_pass
+        && _movement_wake_sources == 0
+        && _movement_event_queue_tail == _movement_event_queue_head
+        && !movement_state.watch_face_changed
+        && !movement_state.woke_from_alarm_handler
+        && !movement_state.background_task_due
+        && movement_state.light_state == MOVEMENT_LIGHT_OFF
+        && !movement_state.is_buzzing
+        && movement_state.le_mode_ticks != 0
+        && movement_state.timeout_ticks != 0
+        && !usb_is_enabled();
+}
+
 bool app_loop(void) {
+    // go straight back to sleep, without a pass through the face or an entry in the wake trace.
+    if (_movement_woke_for_nothing()) return true;
+
     const watch_face_t *wf = &watch_faces[movement_state.current_face_idx];
-    bool woke_up_for_buzzer = false;
+    uint32_t pass_started_at = _movement_stats_counter();
+    _movement_wake_trace_begin();
 
     if (movement_state.watch_face_changed) {
         if (movement_state.settings.bit.button_should_sound) {
@@ -838,22 +1884,24 @@ bool app_loop(void) {
             watch_buzzer_play_note_with_volume(movement_state.next_face_idx ? BUZZER_NOTE_C7 : BUZZER_NOTE_C8, 50, movement_state.settings.bit.button_volume);
         }
         wf->resign(watch_face_contexts[movement_state.current_face_idx]);
+        // faces like settings save their changes as they resign; this is when those changes go to flash.
+        _movement_flush_settings();
         movement_state.current_face_idx = movement_state.next_face_idx;
         // we have just updated the face idx, so we must recache the watch face pointer.
         wf = &watch_faces[movement_state.current_face_idx];
         watch_clear_display();
         movement_request_tick_frequency(1);
+        _movement_ensure_face_setup(movement_state.current_face_idx);
         wf->activate(watch_face_contexts[movement_state.current_face_idx]);
-        event.subsecond = 0;
-        event.event_type = EVENT_ACTIVATE;
+        _movement_activate_pending = true;
         movement_state.watch_face_changed = false;
     }
 
     // if the LED should be off, turn it off
-    if (movement_state.light_ticks == 0) {
-        // unless the user is holding down the LIGHT button, in which case, give them more time.
+    if (movement_state.light_state == MOVEMENT_LIGHT_EXPIRED) {
+        // unless the user is holding down the LIGHT button, in which case, leave it on until they let go.
         if (HAL_GPIO_BTN_LIGHT_read()) {
-            movement_state.light_ticks = 1;
+            movement_state.light_state = MOVEMENT_LIGHT_HELD;
         } else {
             movement_force_led_off();
         }
@@ -862,26 +1910,30 @@ bool app_loop(void) {
     // handle top-of-minute tasks, if the alarm handler told us we need to
     if (movement_state.woke_from_alarm_handler) _movement_handle_top_of_minute();
 
-    // if we have a scheduled background task, handle that here:
-    if (event.event_type == EVENT_TICK && movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
+    // if the alarm fired for a background task deadline, handle that here:
+    if (movement_state.background_task_due) _movement_handle_scheduled_tasks();
 
 #ifndef MOVEMENT_LOW_ENERGY_MODE_FORBIDDEN
-    // if we have timed out of our low energy mode countdown, enter low energy mode.
-    if (movement_state.le_mode_ticks == 0) {
+    // if we have timed out of our low energy mode countdown, enter low energy mode (but let the buzzer finish first).
+    if (movement_state.le_mode_ticks == 0 && !movement_state.is_buzzing) {
         movement_state.le_mode_ticks = -1;
         watch_register_extwake_callback(HAL_GPIO_BTN_ALARM_pin(), cb_alarm_btn_extwake, true);
-        event.event_type = EVENT_NONE;
-        event.subsecond = 0;
+        // anything still in the queue is stale by the time we wake up again, and nothing should be waiting on the timer.
+        _movement_flush_event_queue();
+        _movement_cancel_deadlines();
+        _movement_flush_settings();
+        _movement_wake_trace_count(pass_started_at);
+        _movement_wake_trace_end();
 
         // _sleep_mode_app_loop takes over at this point and loops until le_mode_ticks is reset by the extwake handler,
         // or wake is requested using the movement_request_wake function.
         _sleep_mode_app_loop();
-        // as soon as _sleep_mode_app_loop returns, we prepare to reactivate
-        // ourselves, but first, we check to see if we woke up for the buzzer:
-        if (movement_state.is_buzzing) {
-            woke_up_for_buzzer = true;
-        }
-        event.event_type = EVENT_ACTIVATE;
+        _movement_wake_started_at = _movement_stats_counter();
+        pass_started_at = _movement_wake_started_at;
+        _movement_wake_trace_begin();
+        _movement_wake_latency_pending = true;
+        // as soon as _sleep_mode_app_loop returns, we prepare to reactivate ourselves.
+        _movement_activate_pending = true;
         // this is a hack tho: waking from sleep mode, app_setup does get called, but it happens before we have reset our ticks.
         // need to figure out if there's a better heuristic for determining how we woke up.
         app_setup();
@@ -890,14 +1942,28 @@ bool app_loop(void) {
 
     // default to being allowed to sleep by the face.
     bool can_sleep = true;
+    movement_event_t event;
+
+    if (_movement_activate_pending) {
+        _movement_activate_pending = false;
+        can_sleep = _movement_call_face_loop(movement_state.current_face_idx, (movement_event_t){ EVENT_ACTIVATE, 0 });
+        if (_movement_wake_latency_pending) {
+            _movement_last_wake_latency_us = _movement_stats_elapsed_us(_movement_wake_started_at);
+            _movement_wake_latency_pending = false;
+        }
+    }
+
+    // drain everything the interrupts queued up since the last pass. if a face asks to move to another face,
+    // stop here; the rest of the events belong to whichever face is on screen once the change has been handled.
+    while (!movement_state.watch_face_changed && _movement_dequeue_event(&event)) {
+        // ticks may have been coalesced, so give the face the latest subsecond.
+        if (event.event_type == EVENT_TICK) event.subsecond = movement_state.subsecond;
 
-    if (event.event_type) {
-        event.subsecond = movement_state.subsecond;
-        // the first trip through the loop overrides the can_sleep state
-        can_sleep = wf->loop(event, watch_face_contexts[movement_state.current_face_idx]);
+        // if the loop runs for more than one event, any trip that says it cannot sleep keeps us awake.
+        can_sleep = _movement_call_face_loop(movement_state.current_face_idx, event) && can_sleep;
 
         // Keep light on if user is still interacting with the watch.
-        if (movement_state.light_ticks > 0) {
+        if (movement_state.light_state == MOVEMENT_LIGHT_TIMED || movement_state.light_state == MOVEMENT_LIGHT_HELD) {
             switch (event.event_type) {
                 case EVENT_LIGHT_BUTTON_DOWN:
                 case EVENT_MODE_BUTTON_DOWN:
@@ -905,15 +1971,12 @@ bool app_loop(void) {
                     movement_illuminate_led();
             }
         }
-
-        event.event_type = EVENT_NONE;
     }
 
     // if we have timed out of our timeout countdown, give the app a hint that they can resign.
     if (movement_state.timeout_ticks == 0 && movement_state.current_face_idx != 0) {
+        movement_event_t event = { EVENT_TIMEOUT, movement_state.subsecond };
         movement_state.timeout_ticks = -1;
-        event.event_type = EVENT_TIMEOUT;
-        event.subsecond = movement_state.subsecond;
         // if we run through the loop again to time out, we need to reconsider whether or not we can sleep.
         // if the first trip said true, but this trip said false, we need the false to override, thus
         // we will be using boolean AND:
@@ -921,29 +1984,8 @@ bool app_loop(void) {
         // first trip  | can sleep | cannot sleep | can sleep    | cannot sleep
         // second trip | can sleep | cannot sleep | cannot sleep | can sleep
         //          && | can sleep | cannot sleep | cannot sleep | cannot sleep
-        bool can_sleep2 = wf->loop(event, watch_face_contexts[movement_state.current_face_idx]);
+        bool can_sleep2 = _movement_call_face_loop(movement_state.current_face_idx, event);
         can_sleep = can_sleep && can_sleep2;
-        event.event_type = EVENT_NONE;
-    }
-
-    // Now that we've handled all display update tasks, handle the alarm.
-    if (movement_state.alarm_ticks >= 0) {
-        uint8_t buzzer_phase = (movement_state.alarm_ticks + 80) % 128;
-        if(buzzer_phase == 127) {
-            // failsafe: buzzer could have been disabled in the meantime
-            if (!watch_is_buzzer_or_led_enabled()) watch_enable_buzzer();
-            // play 4 beeps plus pause
-            for(uint8_t i = 0; i < 4; i++) {
-                // TODO: This method of playing the buzzer blocks the UI while it's beeping.
-                // It might be better to time it with the fast tick.
-                watch_buzzer_play_note(movement_state.alarm_note, (i != 3) ? 50 : 75);
-                if (i != 3) watch_buzzer_play_note(BUZZER_NOTE_REST, 50);
-            }
-        }
-        if (movement_state.alarm_ticks == 0) {
-            movement_state.alarm_ticks = -1;
-            _movement_disable_fast_tick_if_possible();
-        }
     }
 
 #if __EMSCRIPTEN__
@@ -955,18 +1997,16 @@ bool app_loop(void) {
     }
 #endif
 
-    event.subsecond = 0;
-
     // if the watch face changed, we can't sleep because we need to update the display.
     if (movement_state.watch_face_changed) can_sleep = false;
 
-    // if we woke up for the buzzer, stay awake until it's finished.
-    if (woke_up_for_buzzer) {
-        while(watch_is_buzzer_or_led_enabled());
-    }
+    // if an interrupt queued another event while we were busy, go around again rather than sleeping on it.
+    if (_movement_event_queue_tail != _movement_event_queue_head) can_sleep = false;
+    // likewise if the top of the minute or a background task came due while we were handling the last one.
+    if (movement_state.woke_from_alarm_handler || movement_state.background_task_due) can_sleep = false;
 
     // if the LED is on, we need to stay awake to keep the TCC running.
-    if (movement_state.light_ticks != -1) can_sleep = false;
+    if (movement_state.light_state != MOVEMENT_LIGHT_OFF) can_sleep = false;
 
     // if we are plugged into USB, we can't sleep because we need to keep the serial shell running.
     if (usb_is_enabled()) {
@@ -974,51 +2014,97 @@ bool app_loop(void) {
         can_sleep = false;
     }
 
+    // whatever the face drew on this pass goes to the display now, in one go.
+    watch_display_commit();
+
+    _movement_wake_trace_count(pass_started_at);
+    if (can_sleep) _movement_wake_trace_end();
+    _movement_slept_after_last_pass = can_sleep;
+
     return can_sleep;
 }
 
-static movement_event_type_t _figure_out_button_event(bool pin_level, movement_event_type_t button_down_event_type, volatile uint16_t *down_timestamp) {
+static void _movement_handle_button_edge(movement_button_t button, bool pin_level) {
+    volatile movement_button_state_t *state = &_movement_buttons[button];
+    _movement_wake_sources |= MOVEMENT_WAKE_BUTTON;
+
     // force alarm off if the user pressed a button.
-    if (movement_state.alarm_ticks) movement_state.alarm_ticks = 0;
+    if (movement_state.is_alarm_playing) {
+        watch_buzzer_abort_sequence();
+        end_alarm_and_disable_buzzer();
+    }
+
+    // every edge is timestamped from the timer, which runs for as long as a button is down or a deadline is pending.
+    watch_timer_enable();
+    uint16_t now = watch_timer_get_count();
 
     if (pin_level) {
         // handle rising edge
-        _movement_enable_fast_tick_if_needed();
-        *down_timestamp = movement_state.fast_ticks + 1;
-        return button_down_event_type;
+        if (state->is_down) return;
+        state->is_down = true;
+        state->long_pressed = false;
+        state->down_at = now;
+        // a press that starts soon enough after a click is the second half of a double click.
+        state->double_clicking = state->clicked && (uint16_t)(now - state->clicked_at) <= MOVEMENT_DOUBLE_CLICK_TICKS;
+        state->clicked = false;
+        _movement_queue_event(state->down_event, 0);
+
+        // if another button is already down, this makes a chord. the chord events are in the same order as the pairs of buttons.
+        for (uint8_t other = 0; other < MOVEMENT_NUM_BUTTONS; other++) {
+            if (other != button && _movement_buttons[other].is_down) {
+                _movement_queue_event(EVENT_LIGHT_MODE_CHORD + other + button - 1, 0);
+            }
+        }
+
+        _movement_set_deadline((movement_deadline_t)button, MOVEMENT_LONG_PRESS_TICKS);
     } else {
-        // this line is hack but it handles the situation where the light button was held for more than 20 seconds.
-        // fast tick is disabled by then, and the LED would get stuck on since there's no one left decrementing light_ticks.
-        if (movement_state.light_ticks == 1) movement_state.light_ticks = 0;
-        // now that that's out of the way, handle falling edge
-        uint16_t diff = movement_state.fast_ticks - *down_timestamp;
-        *down_timestamp = 0;
-        _movement_disable_fast_tick_if_possible();
+        // handle falling edge
+        if (!state->is_down) return;
+        state->is_down = false;
+
+        // a light held past the LED's timeout goes off once the button comes up.
+        if (button == MOVEMENT_BUTTON_LIGHT && movement_state.light_state == MOVEMENT_LIGHT_HELD) movement_state.light_state = MOVEMENT_LIGHT_EXPIRED;
+
         // any press over a half second is considered a long press. Fire the long-up event
-        if (diff > MOVEMENT_LONG_PRESS_TICKS) return button_down_event_type + 3;
-        else return button_down_event_type + 1;
+        if (state->long_pressed || (uint16_t)(now - state->down_at) >= MOVEMENT_LONG_PRESS_TICKS) {
+            _movement_queue_event(state->down_event + 3, 0);
+        } else {
+            _movement_queue_event(state->down_event + 1, 0);
+            if (state->double_clicking) {
+                _movement_queue_event(EVENT_LIGHT_DOUBLE_CLICK + button, 0);
+            } else {
+                // leave the counter running for long enough to see whether a second click follows this one.
+                state->clicked = true;
+                state->clicked_at = now;
+                _movement_set_deadline(MOVEMENT_DEADLINE_CLICK_WINDOW, MOVEMENT_DOUBLE_CLICK_TICKS + 1);
+            }
+        }
+        state->double_clicking = false;
+
+        _movement_clear_deadline((movement_deadline_t)button);
     }
 }
 
 void cb_light_btn_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_LIGHT_read();
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_LIGHT_BUTTON_DOWN, &movement_state.light_down_timestamp);
+    _movement_handle_button_edge(MOVEMENT_BUTTON_LIGHT, pin_level);
 }
 
 void cb_mode_btn_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_MODE_read();
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_MODE_BUTTON_DOWN, &movement_state.mode_down_timestamp);
+    _movement_handle_button_edge(MOVEMENT_BUTTON_MODE, pin_level);
 }
 
 void cb_alarm_btn_interrupt(void) {
     bool pin_level = HAL_GPIO_BTN_ALARM_read();
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_ALARM_BUTTON_DOWN, &movement_state.alarm_down_timestamp);
+    _movement_handle_button_edge(MOVEMENT_BUTTON_ALARM, pin_level);
 }
 
 void cb_alarm_btn_extwake(void) {
+    _movement_wake_sources |= MOVEMENT_WAKE_EXTWAKE;
     // wake up!
     _movement_reset_inactivity_countdown();
 }
@@ -1027,36 +2113,19 @@ void cb_alarm_fired(void) {
 #if __EMSCRIPTEN__
     _wake_up_simulator();
 #endif
+    _movement_wake_sources |= MOVEMENT_WAKE_ALARM;
 
-    movement_state.woke_from_alarm_handler = true;
-}
-
-void cb_fast_tick(void) {
-    movement_state.fast_ticks++;
-    if (movement_state.light_ticks > 0) movement_state.light_ticks--;
-    if (movement_state.alarm_ticks > 0) movement_state.alarm_ticks--;
-    // check timestamps and auto-fire the long-press events
-    // Notice: is it possible that two or more buttons have an identical timestamp? In this case
-    // only one of these buttons would receive the long press event. Don't bother for now...
-    if (movement_state.light_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.light_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
-            event.event_type = EVENT_LIGHT_LONG_PRESS;
-    if (movement_state.mode_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.mode_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
-            event.event_type = EVENT_MODE_LONG_PRESS;
-    if (movement_state.alarm_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.alarm_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
-            event.event_type = EVENT_ALARM_LONG_PRESS;
-    // this is just a fail-safe; fast tick should be disabled as soon as the button is up, the LED times out, and/or the alarm finishes.
-    // but if for whatever reason it isn't, this forces the fast tick off after 20 seconds.
-    if (movement_state.fast_ticks >= 128 * 20) {
-        watch_rtc_disable_periodic_callback(128);
-        movement_state.fast_tick_enabled = false;
+    // the alarm is aimed either at the top of the minute or at the next background task. a task that falls due on
+    // second 0 gets picked up when the top-of-minute handler aims the alarm again.
+    if (movement_state.alarm_second == 0) {
+        _movement_top_of_minute_reached(watch_rtc_get_date_time());
+    } else {
+        movement_state.background_task_due = true;
     }
 }
 
 void cb_tick(void) {
-    event.event_type = EVENT_TICK;
+    _movement_wake_sources |= MOVEMENT_WAKE_TICK;
     watch_date_time_t date_time = watch_rtc_get_date_time();
     if (date_time.unit.second != movement_state.last_second) {
         // TODO: can we consolidate these two ticks?
@@ -1068,23 +2137,26 @@ void cb_tick(void) {
     } else {
         movement_state.subsecond++;
     }
+    _movement_queue_event(EVENT_TICK, movement_state.subsecond);
 }
 
 void cb_accelerometer_event(void) {
     uint8_t int_src = lis2dw_get_interrupt_source();
+    _movement_wake_sources |= MOVEMENT_WAKE_ACCELEROMETER;
 
     if (int_src & LIS2DW_REG_ALL_INT_SRC_DOUBLE_TAP) {
-        event.event_type = EVENT_DOUBLE_TAP;
+        _movement_queue_event(EVENT_DOUBLE_TAP, 0);
         printf("Double tap!\n");
     }
     if (int_src & LIS2DW_REG_ALL_INT_SRC_SINGLE_TAP) {
-        event.event_type = EVENT_SINGLE_TAP;
+        _movement_queue_event(EVENT_SINGLE_TAP, 0);
         printf("Single tap!\n");
     }
 }
 
 void cb_accelerometer_wake(void) {
-    event.event_type = EVENT_ACCELEROMETER_WAKE;
+    _movement_wake_sources |= MOVEMENT_WAKE_ACCELEROMETER;
+    _movement_queue_event(EVENT_ACCELEROMETER_WAKE, 0);
     // also: wake up!
     _movement_reset_inactivity_countdown();
 }
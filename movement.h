@@ -37,6 +37,29 @@ typedef struct {
     uint8_t responds_to_dst_change: 1;
 } movement_watch_face_advisory_t;
 
+/// @brief How often a watch face wants Movement to call its advise function. @see movement_set_advise_interest
+typedef enum {
+    MOVEMENT_ADVISE_EVERY_MINUTE = 0,   // at the top of every minute. This is the default for any face with an advise function.
+    MOVEMENT_ADVISE_HOURLY,             // at the top of every hour, local time.
+    MOVEMENT_ADVISE_AT_TIME,            // once a day, at a particular local time.
+    MOVEMENT_ADVISE_NEVER,              // don't call the advise function at all.
+} movement_advise_interest_t;
+
+// the sensors Movement samples on behalf of faces; see movement_get_temperature and movement_set_sensor_interest.
+typedef enum {
+    MOVEMENT_SENSOR_TEMPERATURE = 0,
+    MOVEMENT_SENSOR_VCC,
+    MOVEMENT_NUM_SENSORS
+} movement_sensor_t;
+
+/// @brief How often the face on screen needs to hear from Movement. @see movement_request_refresh_granularity
+typedef enum {
+    MOVEMENT_REFRESH_PER_SECOND = 0,    // the default: an EVENT_TICK once a second.
+    MOVEMENT_REFRESH_SUBSECOND,         // faster ticks. Movement sets this for you when you request a tick frequency above 1 Hz.
+    MOVEMENT_REFRESH_PER_MINUTE,        // one EVENT_TICK at the top of each minute; the 1 Hz tick is turned off.
+    MOVEMENT_REFRESH_EVENT_ONLY,        // no EVENT_TICK at all; the face only hears about button presses and other events.
+} movement_refresh_granularity_t;
+
 // Movement Preferences
 // These four 32-bit structs store information about the wearer and their preferences. Tentatively, the plan is
 // for Movement to use four 32-bit registers for these preferences and to store them in the RTC's backup registers
@@ -132,13 +155,52 @@ typedef enum {
     EVENT_ACCELEROMETER_WAKE,   // The accelerometer has detected motion and woken up.
     EVENT_SINGLE_TAP,           // Accelerometer detected a single tap. This event is not yet implemented.
     EVENT_DOUBLE_TAP,           // Accelerometer detected a double tap. This event is not yet implemented.
+    EVENT_ALARM_FINISHED,       // The alarm started with movement_play_alarm has finished playing, or was silenced with a button press.
+    EVENT_LIGHT_DOUBLE_CLICK,   // The light button was clicked twice in quick succession. Comes after the second EVENT_LIGHT_BUTTON_UP.
+    EVENT_MODE_DOUBLE_CLICK,    // The mode button was clicked twice in quick succession. Comes after the second EVENT_MODE_BUTTON_UP.
+    EVENT_ALARM_DOUBLE_CLICK,   // The alarm button was clicked twice in quick succession. Comes after the second EVENT_ALARM_BUTTON_UP.
+    EVENT_LIGHT_MODE_CHORD,     // The light and mode buttons are both being held down. Comes after the second button's DOWN event.
+    EVENT_LIGHT_ALARM_CHORD,    // The light and alarm buttons are both being held down. Comes after the second button's DOWN event.
+    EVENT_MODE_ALARM_CHORD,     // The mode and alarm buttons are both being held down. Comes after the second button's DOWN event.
+    EVENT_LOW_ENERGY_BEGIN,     // The watch is entering low energy mode and you are in the foreground. Comes once, before the first EVENT_LOW_ENERGY_UPDATE.
 } movement_event_type_t;
 
+#define MOVEMENT_NUM_EVENT_TYPES (EVENT_LOW_ENERGY_BEGIN + 1)
+
 typedef struct {
     uint8_t event_type;
     uint8_t subsecond;
 } movement_event_t;
 
+/// @brief Counters Movement keeps for each watch face, to show which faces keep the watch awake.
+typedef struct {
+    uint32_t loop_calls[MOVEMENT_NUM_EVENT_TYPES];  // number of calls to the face's loop function, by event type
+    uint64_t active_us;                             // total time spent in the face's loop and advise functions
+    uint32_t worst_loop_us;                         // the longest single call to the face's loop function
+    uint32_t stay_awake_count;                      // number of times the loop function returned false
+} movement_face_stats_t;
+
+/// @brief What woke the watch up. A single wake can have several of these.
+typedef enum {
+    MOVEMENT_WAKE_TICK = 1 << 0,            // the RTC's periodic tick
+    MOVEMENT_WAKE_ALARM = 1 << 1,           // the RTC alarm: the top of the minute, or a background task
+    MOVEMENT_WAKE_BUTTON = 1 << 2,          // a button press or release
+    MOVEMENT_WAKE_EXTWAKE = 1 << 3,         // the alarm button, waking us from low energy mode
+    MOVEMENT_WAKE_ACCELEROMETER = 1 << 4,   // an accelerometer interrupt
+    MOVEMENT_WAKE_TIMER = 1 << 5,           // a long press, double click or LED deadline
+    MOVEMENT_WAKE_BUZZER = 1 << 6,          // the buzzer was playing a sequence
+    MOVEMENT_WAKE_USB = 1 << 7,             // USB was connected, which keeps us awake
+} movement_wake_source_t;
+
+/// @brief One wake in the trace Movement keeps to find out what's draining the battery. The `trace` shell command dumps
+/// these 8 bytes as they are, so utils/wake_trace/wake_trace.py needs to change along with this struct.
+typedef struct {
+    uint32_t woke_at;       // the RTC's date and time register (in UTC) when we woke up
+    uint16_t awake_ms;      // how long we stayed awake, up to 65535; past a couple of seconds, only to the second
+    uint8_t sources;        // movement_wake_source_t bits for whatever woke us
+    uint8_t face_index;     // the face that was on screen
+} movement_wake_trace_entry_t;
+
 extern const int16_t movement_timezone_offsets[];
 
 /** @brief Perform setup for your watch face.
@@ -148,7 +210,9 @@ extern const int16_t movement_timezone_offsets[];
   *          need to keep track of any state in your watch face. If your watch face requires any other setup,
   *          like configuring a pin mode or a peripheral, you may want to do that here too.
   *          This function will be called again after waking from sleep mode, since sleep mode disables all
-  *          of the device's pins and peripherals.
+  *          of the device's pins and peripherals. That second call is deferred: it happens just before Movement
+  *          next calls into your watch face (to activate it, advise it or hand it an event), so a face that stays
+  *          in the background costs nothing on wake.
   * @param watch_face_index The index of this watch face in the global array of watch faces; 0 is the first face,
   *                         1 is the second, etc. You may stash this value in your context if you wish to reference
   *                         it later; your watch face's index is set at launch and will not change.
@@ -199,6 +263,8 @@ typedef void (*watch_face_activate)(void *context);
           **Your watch face MUST NOT wake up peripherals in response to a low power tick.** The purpose of this
           mode is to consume as little energy as possible during the (potentially long) intervals when it's
           unlikely the user is wearing or looking at the watch.
+          Anything that should keep running while the watch sleeps, like the sleep animation, is best started on
+          EVENT_LOW_ENERGY_BEGIN, which comes once as the watch enters low energy mode.
           EVENT_BACKGROUND_TASK is also a special case. @see watch_face_advise for details.
   */
 typedef bool (*watch_face_loop)(movement_event_t event, void *context);
@@ -214,7 +280,9 @@ typedef void (*watch_face_resign)(void *context);
 /** @brief OPTIONAL. Request an opportunity to run a background task.
   * @details Most apps will not need this function, but if you provide it, Movement will call it once per minute in
   *          both active and low power modes, regardless of whether your app is in the foreground. You can check the
-  *          current time to determine whether you require a background task. If you return true here, Movement will
+  *          current time to determine whether you require a background task. If you only need to be asked hourly, or at
+  *          a certain time of day, call movement_set_advise_interest in your setup function; Movement will then skip
+  *          your advise function at every other minute. If you return true here, Movement will
   *          immediately call your loop function with an EVENT_BACKGROUND_TASK event. Note that it will not call your
   *          activate or deactivate functions, since you are not going on screen.
   *
@@ -242,6 +310,14 @@ typedef struct {
     watch_face_advise advise;
 } watch_face_t;
 
+typedef enum {
+    MOVEMENT_LIGHT_OFF = 0,     // the LED is off.
+    MOVEMENT_LIGHT_TIMED,       // the LED is on until its deadline passes.
+    MOVEMENT_LIGHT_HELD,        // the deadline has passed, but the LED stays on until the light button is released.
+    MOVEMENT_LIGHT_EXPIRED,     // the LED is due to be turned off the next time through app_loop.
+    MOVEMENT_LIGHT_FORCED_ON,   // a face turned the LED on with movement_force_led_on, and it stays on until they turn it off.
+} movement_light_state_t;
+
 typedef struct {
     movement_settings_t settings;
 
@@ -249,26 +325,27 @@ typedef struct {
     int16_t current_face_idx;
     int16_t next_face_idx;
     bool watch_face_changed;
-    bool fast_tick_enabled;
-    int16_t fast_ticks;
 
     // LED stuff
-    int16_t light_ticks;
+    movement_light_state_t light_state;
 
     // alarm stuff
-    int16_t alarm_ticks;
+    bool is_alarm_playing;
     bool is_buzzing;
-    watch_buzzer_note_t alarm_note;
 
-    // button tracking for long press
-    uint16_t light_down_timestamp;
-    uint16_t mode_down_timestamp;
-    uint16_t alarm_down_timestamp;
+    // number of events dropped because the event queue was full
+    uint16_t event_queue_overflows;
+
+    // how many times we called a face's advise function at the top of the minute, and how many times we didn't have to
+    uint32_t advise_calls;
+    uint32_t advise_calls_skipped;
 
     // background task handling
     bool woke_from_alarm_handler;
     bool has_scheduled_background_task;
+    bool background_task_due;
     bool needs_wake;
+    uint8_t alarm_second;   // the second the RTC alarm is currently set to match; 0 is the top of the minute.
 
     // low energy mode countdown
     int32_t le_mode_ticks;
@@ -277,7 +354,8 @@ typedef struct {
     int16_t timeout_ticks;
 
     // stuff for subsecond tracking
-    uint8_t tick_frequency;
+    uint8_t tick_frequency;     // 0 when the tick is turned off (see refresh_granularity)
+    uint8_t refresh_granularity;
     uint8_t last_second;
     uint8_t subsecond;
 
@@ -309,6 +387,13 @@ void movement_force_led_off(void);
 
 void movement_request_tick_frequency(uint8_t freq);
 
+// If your face's display only changes once a minute (a clock without seconds), or only in response to button presses,
+// call this from your activate function with MOVEMENT_REFRESH_PER_MINUTE or MOVEMENT_REFRESH_EVENT_ONLY. Movement will
+// turn off the 1 Hz tick and let the watch sleep until the top of the minute, the next background task or a button
+// press. Calling movement_request_tick_frequency turns the tick back on; Movement resets this to MOVEMENT_REFRESH_PER_SECOND
+// whenever the face changes.
+void movement_request_refresh_granularity(movement_refresh_granularity_t granularity);
+
 // note: watch faces can only schedule a background task when in the foreground, since
 // movement will associate the scheduled task with the currently active face.
 void movement_schedule_background_task(watch_date_time_t date_time);
@@ -318,9 +403,24 @@ void movement_schedule_background_task(watch_date_time_t date_time);
 void movement_cancel_background_task(void);
 
 // these functions should work around the limitation of the above functions, which will be deprecated.
+// Movement keeps pending tasks sorted by deadline and sets the RTC alarm for the soonest one, so the watch wakes
+// once per task, even from low energy mode. A pending task does not keep the watch awake; if your face needs to
+// stay out of low energy mode while it's on screen, call movement_request_wake from your tick handler.
 void movement_schedule_background_task_for_face(uint8_t watch_face_index, watch_date_time_t date_time);
 void movement_cancel_background_task_for_face(uint8_t watch_face_index);
 
+// tells Movement when to call a face's advise function: every minute, at the top of every hour, once a day at the given
+// local hour and minute (only used with MOVEMENT_ADVISE_AT_TIME), or never. Call this from your setup function, and again
+// whenever your needs change (e.g. when the wearer sets or turns off an alarm).
+void movement_set_advise_interest(uint8_t watch_face_index, movement_advise_interest_t interest, uint8_t hour, uint8_t minute);
+
+// lets Movement draw a face's low energy display ahead of time. In low energy mode, Movement then calls the face's loop
+// with EVENT_LOW_ENERGY_UPDATE for the next several minutes in a row, keeps what it drew, and on each minute's wake just
+// puts the right frame on the display. Only turn this on if your low energy display depends on nothing but the time,
+// and you get that time from movement_get_local_date_time(), which returns the minute being drawn while this happens.
+// Those updates must only draw: start animations or change the tick frequency on EVENT_LOW_ENERGY_BEGIN instead.
+void movement_set_low_energy_prerender(uint8_t watch_face_index, bool prerender);
+
 void movement_request_sleep(void);
 void movement_request_wake(void);
 
@@ -366,8 +466,14 @@ void movement_set_backlight_color(movement_color_t color);
 uint8_t movement_get_backlight_dwell(void);
 void movement_set_backlight_dwell(uint8_t value);
 
+// Saves the settings. They go to the RTC's BKUP[0] register right away, which survives anything short of a loss of
+// power, and are written to flash the next time the watch changes faces or goes into low energy mode, if they changed.
 void movement_store_settings(void);
 
+// Gets and sets the wearer's location, which lives in BKUP[1] and is written to flash the same way as the settings.
+movement_location_t movement_get_location(void);
+void movement_set_location(movement_location_t location);
+
 /// TODO: For #SecondMovement: Should we have a counter that watch faces increment when they enable an alarm, and decrement when they disable it?
 /// Or should there be a watch face function where watch faces can tell us if they have an alarm enabled?
 /// Worth considering a better way to handle this.
@@ -386,7 +492,58 @@ bool movement_set_accelerometer_background_rate(lis2dw_data_rate_t new_rate);
 uint8_t movement_get_accelerometer_motion_threshold(void);
 bool movement_set_accelerometer_motion_threshold(uint8_t new_threshold);
 
+// Allocates memory for a watch face from Movement's face arena. Use this in your setup function where you would
+// otherwise call malloc, for your context and anything else that lives as long as it does. The memory is zeroed, and
+// there's no way to free it; setup is called again after every wake from low energy mode, so only allocate when
+// *context_ptr is NULL.
+void *movement_alloc_face_context(size_t size);
+
+typedef struct {
+    uint16_t arena_bytes;   // bytes claimed from the face arena, rounded up for alignment
+} movement_face_memory_t;
+
+// how much memory each face has claimed, and a printout of the same for the boot log and the `mem` shell command.
+const movement_face_memory_t *movement_get_face_memory(uint8_t watch_face_index);
+size_t movement_get_face_arena_used(void);
+size_t movement_get_face_arena_size(void);
+void movement_print_face_memory(void);
+
+// the index into watch_faces of the face that's on screen right now.
+uint8_t movement_get_current_face_index(void);
+
+// per-face time and event accounting, plus a few of Movement's own counters. used by the `stats` shell command.
+const movement_face_stats_t *movement_get_face_stats(uint8_t watch_face_index);
+void movement_reset_face_stats(void);
+uint32_t movement_get_advise_calls(void);
+uint32_t movement_get_advise_calls_skipped(void);
+uint16_t movement_get_event_queue_overflows(void);
+// time from leaving low energy mode until the foreground face had drawn its first frame, for the most recent wake.
+uint32_t movement_get_last_wake_latency_us(void);
+
+// the most recent wakes, oldest first. The trace lives in RAM that isn't cleared at startup, so it survives low energy
+// mode and a soft reset (but not a loss of power). Used by the `trace` shell command.
+uint16_t movement_get_wake_trace_length(void);
+const movement_wake_trace_entry_t *movement_get_wake_trace_entry(uint16_t index);
+void movement_clear_wake_trace(void);
+
 // If the board has a temperature sensor, this function will give you the temperature in degrees celsius.
 // If the board has multiple temperature sensors, it will use the most accurate one available.
 // If the board has no temperature sensors, it will return 0xFFFFFFFF.
+// This always takes a new reading.
 float movement_get_temperature(void);
+// the battery voltage in millivolts, also read fresh every time.
+uint16_t movement_get_vcc_voltage(void);
+// Movement keeps the last reading of each sensor. These return it if it was taken within the last minute, so every face
+// that opts in during the same minute shares one ADC power-up. Use them where a reading up to 60 seconds old is fine,
+// like a low battery indicator or a scheduled log entry.
+float movement_get_cached_temperature(void);
+uint16_t movement_get_cached_vcc_voltage(void);
+// the same, but only reusing a reading taken within the last max_age seconds. 0 means this second.
+float movement_get_temperature_no_older_than(uint32_t max_age);
+uint16_t movement_get_vcc_voltage_no_older_than(uint32_t max_age);
+
+// asks Movement to sample a sensor every interval_minutes minutes (counting from local midnight, so use a divisor of 1440),
+// or never if interval_minutes is 0. Scheduled readings are taken at the top of the minute, before any face is advised,
+// so a face that reads the sensor from its advise function or background task that minute gets the fresh reading
+// without powering anything up. When several faces subscribe to the same sensor, they all share its readings.
+void movement_set_sensor_interest(uint8_t watch_face_index, movement_sensor_t sensor, uint8_t interval_minutes);
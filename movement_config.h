@@ -105,4 +105,12 @@ const watch_face_t watch_faces[] = {
  */
 #define MOVEMENT_DEFAULT_LED_DURATION 1
 
+/* The RAM budget for watch face contexts, in bytes.
+ * Faces allocate their state from a static arena of this size instead of the heap, so it's accounted for at link time:
+ * if the arena and everything else won't fit in RAM, the build fails. The build also adds up what the faces listed
+ * above allocate, and fails if that won't fit in the arena; the report printed at boot and the `mem` shell command
+ * show what each face claimed.
+ */
+#define MOVEMENT_FACE_ARENA_SIZE 2048
+
 #endif // MOVEMENT_CONFIG_H_
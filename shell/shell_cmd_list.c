@@ -27,14 +27,27 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "filesystem.h"
 #include "watch.h"
 #include "delay.h"
+#include "movement.h"
+#include "base64.h"
+
+#if __EMSCRIPTEN__
+#include "watch_display_stats.h"
+#endif
 
 static int help_cmd(int argc, char *argv[]);
 static int flash_cmd(int argc, char *argv[]);
 static int stress_cmd(int argc, char *argv[]);
+static int stats_cmd(int argc, char *argv[]);
+static int mem_cmd(int argc, char *argv[]);
+static int trace_cmd(int argc, char *argv[]);
+#if __EMSCRIPTEN__
+static int lcd_cmd(int argc, char *argv[]);
+#endif
 
 shell_command_t g_shell_commands[] = {
     {
@@ -114,6 +127,36 @@ shell_command_t g_shell_commands[] = {
         .max_args = 2,
         .cb = stress_cmd,
     },
+    {
+        .name = "stats",
+        .help = "print per-face event and time counters; usage: stats [reset]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = stats_cmd,
+    },
+    {
+        .name = "mem",
+        .help = "print how much of the face context arena each face has claimed",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = mem_cmd,
+    },
+    {
+        .name = "trace",
+        .help = "dump recent wakes as base64, for utils/wake_trace; usage: trace [clear]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = trace_cmd,
+    },
+#if __EMSCRIPTEN__
+    {
+        .name = "lcd",
+        .help = "print simulator display counters; usage: lcd [reset]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = lcd_cmd,
+    },
+#endif
 };
 
 const size_t g_num_shell_commands = sizeof(g_shell_commands) / sizeof(shell_command_t);
@@ -171,3 +214,115 @@ static int stress_cmd(int argc, char *argv[]) {
 
     return 0;
 }
+
+static int stats_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "reset") != 0) {
+            return -1;
+        }
+        movement_reset_face_stats();
+        return 0;
+    }
+
+    const movement_face_stats_t *stats;
+    for (uint8_t i = 0; (stats = movement_get_face_stats(i)) != NULL; i++) {
+        printf("face %u: active %lu ms, worst %lu us, stayed awake %lu times\r\n",
+                i,
+                (unsigned long)(stats->active_us / 1000),
+                (unsigned long)stats->worst_loop_us,
+                (unsigned long)stats->stay_awake_count
+        );
+        // loop calls by event type, numbered as in movement_event_type_t; only the ones that happened.
+        printf("  events:");
+        for (uint8_t event_type = 0; event_type < MOVEMENT_NUM_EVENT_TYPES; event_type++) {
+            if (stats->loop_calls[event_type]) {
+                printf(" %u=%lu", event_type, (unsigned long)stats->loop_calls[event_type]);
+            }
+        }
+        printf("\r\n");
+    }
+
+    printf("advise calls: %lu (%lu skipped)\r\n",
+            (unsigned long)movement_get_advise_calls(),
+            (unsigned long)movement_get_advise_calls_skipped()
+    );
+    printf("event queue overflows: %u\r\n", movement_get_event_queue_overflows());
+    printf("last wake latency: %lu us\r\n", (unsigned long)movement_get_last_wake_latency_us());
+
+    return 0;
+}
+
+static int mem_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    movement_print_face_memory();
+
+    return 0;
+}
+
+static int trace_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "clear") != 0) {
+            return -1;
+        }
+        movement_clear_wake_trace();
+        return 0;
+    }
+
+    // one wake per line, oldest first: the movement_wake_trace_entry_t as it sits in memory, base64 encoded.
+    uint16_t length = movement_get_wake_trace_length();
+    for (uint16_t i = 0; i < length; i++) {
+        // room for up to 12 bytes, like b64encode; an entry is 8.
+        char base64_line[17];
+        b64_encode((const unsigned char *)movement_get_wake_trace_entry(i), sizeof(movement_wake_trace_entry_t), (unsigned char *)base64_line);
+        printf("%s\r\n", base64_line);
+        delay_ms(10);
+    }
+
+    return 0;
+}
+
+#if __EMSCRIPTEN__
+static int lcd_cmd(int argc, char *argv[]) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "reset") != 0) {
+            return -1;
+        }
+        watch_display_reset_stats();
+        return 0;
+    }
+
+    const watch_display_stats_t *stats = watch_display_get_stats();
+    const watch_display_stats_t *last = watch_display_get_last_commit_stats();
+    printf("commits: %lu (%lu changed the display)\r\n", (unsigned long)stats->commits, (unsigned long)stats->frames);
+    printf("writes: %lu (%lu unchanged)\r\n", (unsigned long)stats->writes, (unsigned long)stats->unchanged_writes);
+    printf("words written: %lu\r\n", (unsigned long)stats->words_written);
+    if (stats->commits) {
+        printf("writes per commit: %lu\r\n", (unsigned long)(stats->writes / stats->commits));
+    }
+    printf("last commit: %lu writes (%lu unchanged), %lu words\r\n",
+            (unsigned long)last->writes,
+            (unsigned long)last->unchanged_writes,
+            (unsigned long)last->words_written
+    );
+    for (uint8_t event_type = 0; event_type < WATCH_DISPLAY_STATS_NUM_EVENTS; event_type++) {
+        const watch_display_event_stats_t *event_stats = watch_display_get_event_stats(event_type);
+        if (event_stats->writes == 0) continue;
+        if (event_type == EVENT_NONE) {
+            printf("outside a face's loop: %lu writes (%lu unchanged)\r\n",
+                    (unsigned long)event_stats->writes, (unsigned long)event_stats->unchanged_writes);
+        } else {
+            printf("event %u: %lu handled, %lu writes (%lu unchanged), %lu writes per event\r\n",
+                    event_type,
+                    (unsigned long)event_stats->events,
+                    (unsigned long)event_stats->writes,
+                    (unsigned long)event_stats->unchanged_writes,
+                    (unsigned long)(event_stats->events ? event_stats->writes / event_stats->events : 0)
+            );
+        }
+    }
+
+    return 0;
+}
+#endif
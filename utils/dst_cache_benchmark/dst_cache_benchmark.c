@@ -0,0 +1,204 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Host-side benchmark for Movement's DST offset cache. It replays a year of top-of-minute wakes against the real utz
+// zone table and compares the old strategy (recompute every zone every 30 minutes) with the transition-aware one in
+// movement.c (compare against the soonest known transition; recompute only the zones that crossed it). Both caches are
+// checked against each other every minute, so the benchmark doubles as a correctness check.
+//
+// The cost that matters on the watch is the number of utz lookups (unpack_zone + get_current_offset), so that is what
+// we report per minute, alongside host CPU time as a rough sanity check.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "utz.h"
+#include "zones.h"
+
+#define TIMEZONE_DOES_NOT_OBSERVE (-127)
+#define DST_TRANSITION_UNKNOWN 0
+#define DST_TRANSITION_NEVER UINT32_MAX
+#define DST_TRANSITION_PROBE_STEP (7 * 86400)
+#define DST_TRANSITION_HORIZON (366 * 86400)
+#define DST_ZONES_RESOLVED_PER_MINUTE 4
+
+static uint64_t lookups;
+
+static int8_t offset_at(uzone_t *zone, uint32_t timestamp) {
+    time_t t = (time_t)timestamp + zone->offset.hours * 3600 + zone->offset.minutes * 60;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    udatetime_t udate_time = {
+        .date.dayofmonth = tm.tm_mday,
+        .date.dayofweek = dayofweek(UYEAR_FROM_YEAR(tm.tm_year + 1900), tm.tm_mon + 1, tm.tm_mday),
+        .date.month = tm.tm_mon + 1,
+        .date.year = UYEAR_FROM_YEAR(tm.tm_year + 1900),
+        .time.hour = tm.tm_hour,
+        .time.minute = tm.tm_min,
+        .time.second = tm.tm_sec
+    };
+    uoffset_t offset;
+    get_current_offset(zone, &udate_time, &offset);
+    lookups++;
+    return (offset.hours * 60 + offset.minutes) / 15;
+}
+
+/// the old strategy: every 30 minutes, unpack and look up every zone.
+static int8_t old_cache[NUM_ZONE_NAMES];
+
+static void old_update(uint32_t now) {
+    for (uint8_t i = 0; i < NUM_ZONE_NAMES; i++) {
+        uzone_t zone;
+        unpack_zone(&zone_defns[i], "", &zone);
+        old_cache[i] = zone.rules_len ? offset_at(&zone, now) : TIMEZONE_DOES_NOT_OBSERVE;
+    }
+}
+
+/// the new strategy, mirroring movement.c.
+static int8_t new_cache[NUM_ZONE_NAMES];
+static uint32_t next_transition[NUM_ZONE_NAMES];
+static uint32_t soonest_transition;
+
+static uint32_t find_next_transition(uzone_t *zone, uint32_t now, int8_t current_offset) {
+    uint32_t low = now - now % 60;
+    uint32_t high = low;
+
+    do {
+        low = high;
+        high += DST_TRANSITION_PROBE_STEP;
+        if (high - now > DST_TRANSITION_HORIZON) return high;
+    } while (offset_at(zone, high) == current_offset);
+
+    while (high - low > 60) {
+        uint32_t mid = low + ((high - low) / 120) * 60;
+        if (offset_at(zone, mid) == current_offset) low = mid;
+        else high = mid;
+    }
+
+    return high;
+}
+
+static void new_update_zone(uint8_t i, uint32_t now, bool find_next) {
+    uzone_t zone;
+    unpack_zone(&zone_defns[i], "", &zone);
+    if (!zone.rules_len) {
+        new_cache[i] = TIMEZONE_DOES_NOT_OBSERVE;
+        next_transition[i] = DST_TRANSITION_NEVER;
+        return;
+    }
+    new_cache[i] = offset_at(&zone, now);
+    next_transition[i] = find_next ? find_next_transition(&zone, now, new_cache[i]) : DST_TRANSITION_UNKNOWN;
+}
+
+static void new_update_soonest(void) {
+    soonest_transition = DST_TRANSITION_NEVER;
+    for (uint8_t i = 0; i < NUM_ZONE_NAMES; i++) {
+        if (next_transition[i] < soonest_transition) soonest_transition = next_transition[i];
+    }
+}
+
+static void new_boot(uint32_t now) {
+    for (uint8_t i = 0; i < NUM_ZONE_NAMES; i++) new_update_zone(i, now, false);
+    new_update_soonest();
+}
+
+static void new_top_of_minute(uint32_t now) {
+    uint8_t zones_to_resolve = DST_ZONES_RESOLVED_PER_MINUTE;
+
+    if (now < soonest_transition) return;
+
+    for (uint8_t i = 0; i < NUM_ZONE_NAMES; i++) {
+        if (next_transition[i] == DST_TRANSITION_UNKNOWN) {
+            if (zones_to_resolve) {
+                zones_to_resolve--;
+                new_update_zone(i, now, true);
+            } else if ((now / 60) % 30 == 0) {
+                new_update_zone(i, now, false);
+            }
+        } else if (next_transition[i] <= now) {
+            new_update_zone(i, now, true);
+        }
+    }
+    new_update_soonest();
+}
+
+static double seconds_since(struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+int main(void) {
+    // one year of minutes, starting at midnight UTC on January 1, 2025.
+    const uint32_t start = 1735689600;
+    const uint32_t minutes = 366 * 24 * 60;
+    struct timespec t0;
+    uint32_t mismatches = 0;
+
+    lookups = 0;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t0);
+    old_update(start);
+    for (uint32_t m = 1; m < minutes; m++) {
+        uint32_t now = start + m * 60;
+        if ((now / 60) % 30 == 0) old_update(now);
+    }
+    double old_seconds = seconds_since(&t0);
+    uint64_t old_lookups = lookups;
+
+    lookups = 0;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t0);
+    new_boot(start);
+    for (uint32_t m = 1; m < minutes; m++) new_top_of_minute(start + m * 60);
+    double new_seconds = seconds_since(&t0);
+    uint64_t new_lookups = lookups;
+
+    // now run both side by side and compare. the old cache can lag a transition by up to 30 minutes, so we check
+    // the new cache against a fresh lookup instead.
+    old_update(start);
+    new_boot(start);
+    for (uint32_t m = 1; m < minutes; m++) {
+        uint32_t now = start + m * 60;
+        new_top_of_minute(now);
+        // give the new strategy its first half hour to resolve every zone before holding it to the minute.
+        if (m < 30) continue;
+        old_update(now);
+        for (uint8_t i = 0; i < NUM_ZONE_NAMES; i++) {
+            if (old_cache[i] != new_cache[i]) {
+                if (mismatches < 10) printf("mismatch: zone %d at %u: expected %d, cached %d\n", i, now, old_cache[i], new_cache[i]);
+                mismatches++;
+            }
+        }
+    }
+
+    printf("zones: %d, minutes simulated: %u\n", NUM_ZONE_NAMES, minutes);
+    printf("every 30 minutes:  %10.3f utz lookups/minute, %8.1f ns/minute on this host\n",
+           (double)old_lookups / minutes, old_seconds * 1e9 / minutes);
+    printf("transition-aware:  %10.3f utz lookups/minute, %8.1f ns/minute on this host\n",
+           (double)new_lookups / minutes, new_seconds * 1e9 / minutes);
+    printf("mismatches: %u\n", mismatches);
+
+    return mismatches ? 1 : 0;
+}
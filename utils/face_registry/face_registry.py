@@ -0,0 +1,168 @@
+# MIT License
+#
+# Copyright (c) 2025 Joey Castillo
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Works out which watch faces the build needs, so that faces that aren't in movement_config.h are never compiled.
+#
+#   face_registry.py sources movement_config.h <face sources...>
+#       prints the face sources that define a face listed in watch_faces[]. The Makefile passes it everything in
+#       watch-faces.mk, which stays the list of every face there is.
+#
+#   face_registry.py sizes [--size arm-none-eabi-size] [--objdir build] movement_config.h <face sources...>
+#       prints the flash (text + data) and RAM (data + bss) of each configured face's object file, largest first.
+#
+#   face_registry.py contexts movement_config.h <face sources...>
+#       prints a C expression for the face arena that the configured faces need: one MOVEMENT_FACE_CONTEXT_BYTES() for
+#       each movement_alloc_face_context call in each face's source, for every time the face appears in watch_faces[].
+#       movement.c checks it against MOVEMENT_FACE_ARENA_SIZE, so a face list that doesn't fit fails the build. The
+#       sizes have to be things movement.c can see, like sizeof a type or a constant from the face's header.
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+
+FACE_DEFINE = re.compile(r'^\s*#define\s+([A-Za-z_][A-Za-z0-9_]*)\s+\(\(const watch_face_t\)', re.MULTILINE)
+FACE_ALLOC = re.compile(r'\bmovement_alloc_face_context\s*\(')
+# anything that reaches into the face's state is only known once setup runs.
+RUNTIME_SIZE = re.compile(r'->|\.|\[')
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.DOTALL)
+    return re.sub(r'//[^\n]*', ' ', text)
+
+
+def configured_faces(config_path):
+    with open(config_path) as f:
+        config = strip_comments(f.read())
+    match = re.search(r'watch_faces\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;', config, re.DOTALL)
+    if match is None:
+        sys.exit(f"{config_path}: can't find the watch_faces[] table")
+    # preprocessor lines inside the table are allowed; whatever faces they mention all get built.
+    body = re.sub(r'^\s*#[^\n]*', ' ', match.group(1), flags=re.MULTILINE)
+    return [name for name in re.split(r'[\s,]+', body) if name]
+
+
+def faces_by_source(sources):
+    faces = {}
+    for source in sources:
+        header = os.path.splitext(source)[0] + ".h"
+        if not os.path.exists(header):
+            continue
+        with open(header) as f:
+            for name in FACE_DEFINE.findall(f.read()):
+                faces[name] = source
+    return faces
+
+
+def face_sources(config_path, sources):
+    available = faces_by_source(sources)
+    needed = []
+    for face in configured_faces(config_path):
+        if face not in available:
+            sys.exit(f"{config_path}: {face} isn't defined by any face in watch-faces.mk")
+        if available[face] not in needed:
+            needed.append(available[face])
+    return needed
+
+
+def context_allocations(source):
+    with open(source) as f:
+        text = strip_comments(f.read())
+    sizes = []
+    for match in FACE_ALLOC.finditer(text):
+        depth = 1
+        end = match.end()
+        while depth:
+            if end >= len(text):
+                sys.exit(f"{source}: unterminated call to movement_alloc_face_context")
+            depth += {'(': 1, ')': -1}.get(text[end], 0)
+            end += 1
+        size = ' '.join(text[match.end():end - 1].split())
+        if RUNTIME_SIZE.search(size):
+            sys.exit(f"{source}: can't size movement_alloc_face_context({size}) when building; "
+                     "allocate a size known at compile time")
+        sizes.append(size)
+    return sizes
+
+
+def context_sizes(config_path, sources):
+    available = faces_by_source(sources)
+    terms = []
+    # faces that appear twice in watch_faces[] are set up twice.
+    for face in configured_faces(config_path):
+        if face not in available:
+            sys.exit(f"{config_path}: {face} isn't defined by any face in watch-faces.mk")
+        terms += [f"MOVEMENT_FACE_CONTEXT_BYTES({size})" for size in context_allocations(available[face])]
+    return "+".join(terms) if terms else "0"
+
+
+def find_object(objdir, source):
+    target = os.path.splitext(os.path.basename(source))[0] + ".o"
+    for root, _, files in os.walk(objdir):
+        if target in files:
+            return os.path.join(root, target)
+    return None
+
+
+def print_sizes(size_tool, objdir, sources):
+    rows = []
+    for source in sources:
+        obj = find_object(objdir, source)
+        if obj is None:
+            sys.exit(f"no object file for {source} in {objdir}; build first")
+        # Berkeley format: text data bss dec hex filename
+        output = subprocess.run([size_tool, obj], check=True, capture_output=True, text=True).stdout
+        text, data, bss = (int(field) for field in output.splitlines()[1].split()[:3])
+        rows.append((text + data, data + bss, os.path.basename(source)))
+
+    rows.sort(reverse=True)
+    print(f"{'flash':>8} {'ram':>8}  face")
+    for flash, ram, name in rows:
+        print(f"{flash:8} {ram:8}  {name}")
+    print(f"{sum(row[0] for row in rows):8} {sum(row[1] for row in rows):8}  total ({len(rows)} faces)")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="List and measure the watch faces a build needs.")
+    parser.add_argument("command", choices=["sources", "sizes", "contexts"])
+    parser.add_argument("--size", default="arm-none-eabi-size", help="the size tool to run on object files")
+    parser.add_argument("--objdir", default="build", help="where to look for object files")
+    parser.add_argument("config", help="path to movement_config.h")
+    parser.add_argument("sources", nargs="*", help="every face source file")
+    args = parser.parse_args()
+
+    if args.command == "contexts":
+        print(context_sizes(args.config, args.sources))
+        return
+
+    sources = face_sources(args.config, args.sources)
+    if args.command == "sources":
+        print(" ".join(sources))
+    else:
+        print_sizes(args.size, args.objdir, sources)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,229 @@
+# MIT License
+#
+# Copyright (c) 2025 Joey Castillo
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Precomputes, for every LCD type, display position and character, what watch_display_character does to the segment
+# data: which segments it clears and which it sets on each COM line. With these tables, drawing a character is one
+# masked update per COM line instead of a walk over eight segment mappings.
+#
+#   glyph_masks.py watch_common_display.h watch_glyph_masks.h
+#
+# The Makefile runs this on every build. The output file is only rewritten when its contents change, so an unchanged
+# table doesn't cause a rebuild.
+
+import re
+import sys
+
+
+FIRST_CHARACTER = 0x20
+LAST_CHARACTER = 0x7e
+# the windowed set masks are stored in 16 bits; every position's segments fit in a window that size.
+WINDOW_BITS = 16
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.DOTALL)
+    return re.sub(r'//[^\n]*', ' ', text)
+
+
+def array_body(header, name):
+    match = re.search(name + r'\s*\[\s*\]\s*=\s*\{(.*?)\n\}\s*;', header, re.DOTALL)
+    if match is None:
+        sys.exit(f"can't find {name} in the display header")
+    return match.group(1)
+
+
+def character_set(header, name):
+    glyphs = [int(value, 2) for value in re.findall(r'0b([01]{8})', array_body(header, name))]
+    if len(glyphs) != LAST_CHARACTER - FIRST_CHARACTER + 1:
+        sys.exit(f"{name} has {len(glyphs)} characters, expected {LAST_CHARACTER - FIRST_CHARACTER + 1}")
+    return glyphs
+
+
+def display_mapping(header, name):
+    segments = []
+    for com, seg, missing in re.findall(r'\.com\s*=\s*(\d+)\s*,\s*\.seg\s*=\s*(\d+)|(segment_does_not_exist)',
+                                        array_body(header, name)):
+        segments.append(None if missing else (int(com), int(seg)))
+    if not segments or len(segments) % 8:
+        sys.exit(f"{name} doesn't hold eight segments per position")
+    return [segments[i:i + 8] for i in range(0, len(segments), 8)]
+
+
+# These are the substitutions watch_display_character used to make at run time: characters that some positions can't
+# show get swapped for the nearest thing they can.
+def substitute_custom(character, position):
+    if 1 < position < 8:
+        if character == 'R': return 'r'  # We can't display uppercase R in these positions
+        if character == 'T': return 't'  # lowercase t is the only option for these positions
+    return character
+
+
+def substitute_classic(character, position):
+    if position in (4, 6):
+        if character == '7': character = '&'  # "lowercase" 7
+        elif character == 'A': character = 'a'  # A needs to be lowercase
+        elif character == 'o': character = 'O'  # O needs to be uppercase
+        elif character == 'L': character = '!'  # L needs to be in top half
+        elif character in 'MmN': character = 'n'  # M and uppercase N need to be lowercase n
+        elif character == 'c': character = 'C'  # C needs to be uppercase
+        elif character == 'J': character = 'j'  # same
+        elif character in 'vVUWw': character = 'u'  # bottom segment duplicated, so show in top half
+        elif character in 'tT': character = '+'  # avoid confusion with uppercase E
+    else:
+        if character == 'u': character = 'v'  # we can use the bottom segment; move to lower half
+        elif character == 'j': character = 'J'  # same but just display a normal J
+        elif character == '.': character = '_'  # we can use the bottom segment; make dot an underscore
+    if position > 1:
+        if character == 'T': character = 't'  # uppercase T only works in positions 0 and 1
+    if position == 1:
+        if character == 'a': character = 'A'  # A needs to be uppercase
+        elif character == 'o': character = 'O'  # O needs to be uppercase
+        elif character == 'i': character = 'l'  # I needs to be uppercase (use an l, it looks the same)
+        elif character == 'n': character = 'N'  # N needs to be uppercase
+        elif character == 'r': character = 'R'  # R needs to be uppercase
+        elif character == 'd': character = 'D'  # D needs to be uppercase
+        elif character in 'vVu': character = 'U'  # side segments shared, make uppercase
+        elif character == 'b': character = 'B'  # B needs to be uppercase
+        elif character == 'c': character = 'C'  # C needs to be uppercase
+    else:
+        if character == 'R': character = 'r'  # R needs to be lowercase almost everywhere
+    if position != 0:
+        if character == 'I': character = 'l'  # uppercase I only works in position 0
+    return character
+
+
+def pixel_writes(lcd, character, position):
+    """The pixels watch_display_character sets (True) and clears (False), in the order it touches them."""
+    writes = []
+    if lcd['name'] == 'Classic':
+        character = substitute_classic(character, position)
+        if position == 0: writes.append(((0, 15), False))  # clear funky ninth segment
+    else:
+        character = substitute_custom(character, position)
+
+    glyph = lcd['glyphs'][ord(character) - FIRST_CHARACTER]
+    for bit, address in enumerate(lcd['mapping'][position]):
+        if address is not None: writes.append((address, bool(glyph & (1 << bit))))
+
+    if character == 'T' and position == 1: writes.append(((1, 12), True))  # add descender
+    elif position == 0 and character in 'BD@': writes.append(((0, 15), True))  # add funky ninth segment
+    elif position == 1 and character in 'BD@': writes.append(((0, 12), True))  # add funky ninth segment
+    return writes
+
+
+def position_masks(lcd, position):
+    """Returns the clear masks for a position (one per COM), the shift of its window and its windowed set masks."""
+    coms = lcd['coms']
+    sets, clears = [], []
+    for code in range(FIRST_CHARACTER, LAST_CHARACTER + 1):
+        final = dict(pixel_writes(lcd, chr(code), position))
+        set_mask, clear_mask = [0] * coms, [0] * coms
+        for (com, seg), on in final.items():
+            if com >= coms: sys.exit(f"{lcd['name']} position {position} uses COM{com}")
+            if on: set_mask[com] |= 1 << seg
+            else: clear_mask[com] |= 1 << seg
+        sets.append(set_mask)
+        clears.append(clear_mask)
+
+    # one clear mask has to do for the whole position, so every character must clear all of it that it doesn't set.
+    position_clear = [0] * coms
+    for clear_mask in clears:
+        position_clear = [a | b for a, b in zip(position_clear, clear_mask)]
+    for code, (set_mask, clear_mask) in enumerate(zip(sets, clears), FIRST_CHARACTER):
+        if [c & ~s for c, s in zip(position_clear, set_mask)] != clear_mask:
+            sys.exit(f"{lcd['name']} position {position}: {chr(code)!r} leaves segments alone that others clear")
+
+    used = 0
+    for mask in position_clear + [bit for set_mask in sets for bit in set_mask]: used |= mask
+    shift = (used & -used).bit_length() - 1 if used else 0
+    if used >> shift >= 1 << WINDOW_BITS:
+        sys.exit(f"{lcd['name']} position {position} spans more than {WINDOW_BITS} segments")
+    return position_clear, shift, [[mask >> shift for mask in set_mask] for set_mask in sets]
+
+
+def generate(header_path):
+    with open(header_path) as f:
+        header = strip_comments(f.read())
+
+    lcds = []
+    for name, coms in (('Classic', 3), ('Custom', 4)):
+        lcds.append({
+            'name': name,
+            'coms': coms,
+            'glyphs': character_set(header, f'{name}_LCD_Character_Set'),
+            'mapping': display_mapping(header, f'{name}_LCD_Display_Mapping'),
+        })
+
+    out = []
+    out.append('// Generated by utils/glyph_masks/glyph_masks.py from watch_common_display.h. Do not edit.')
+    out.append('')
+    out.append('#pragma once')
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('')
+    out.append(f'#define WATCH_GLYPH_FIRST_CHARACTER 0x{FIRST_CHARACTER:02x}')
+    out.append(f'#define WATCH_GLYPH_LAST_CHARACTER 0x{LAST_CHARACTER:02x}')
+    out.append(f'#define WATCH_GLYPH_NUM_CHARACTERS {LAST_CHARACTER - FIRST_CHARACTER + 1}')
+    for lcd in lcds:
+        name, coms, positions = lcd['name'], lcd['coms'], len(lcd['mapping'])
+        masks = [position_masks(lcd, position) for position in range(positions)]
+        upper = name.upper()
+        out.append('')
+        out.append(f'#define {upper}_LCD_GLYPH_COMS {coms}')
+        out.append(f'#define {upper}_LCD_GLYPH_POSITIONS {positions}')
+        out.append('')
+        out.append(f'// segments each position owns: drawing any character there clears these, then sets its own.')
+        out.append(f'static const uint32_t {name}_LCD_Glyph_Clear[{positions}][{coms}] = {{')
+        for position, (clear, _, _) in enumerate(masks):
+            out.append('    { ' + ', '.join(f'0x{m:08x}' for m in clear) + f' }}, // {position}')
+        out.append('};')
+        out.append('')
+        out.append(f'// the set masks below are stored shifted right by this much.')
+        out.append(f'static const uint8_t {name}_LCD_Glyph_Shift[{positions}] = {{ ' +
+                   ', '.join(str(shift) for _, shift, _ in masks) + ' };')
+        out.append('')
+        out.append(f'static const uint16_t {name}_LCD_Glyph_Set[{positions}][WATCH_GLYPH_NUM_CHARACTERS][{coms}] = {{')
+        for position, (_, _, sets) in enumerate(masks):
+            out.append(f'    {{ // {position}')
+            for code, set_mask in enumerate(sets, FIRST_CHARACTER):
+                label = 'backslash' if chr(code) == '\\' else '[space]' if code == 0x20 else chr(code)
+                out.append('        { ' + ', '.join(f'0x{m:04x}' for m in set_mask) + f' }}, // {label}')
+            out.append('    },')
+        out.append('};')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(f'usage: {sys.argv[0]} watch_common_display.h watch_glyph_masks.h')
+    text = generate(sys.argv[1])
+    try:
+        with open(sys.argv[2]) as f:
+            if f.read() == text: return
+    except FileNotFoundError:
+        pass
+    with open(sys.argv[2], 'w') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,237 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Host-side benchmark for watch_display_character. It compares the old way of drawing a character (an if/else
+// ladder of substitutions, then a walk over the eight segments of the position's mapping, one watch_set_pixel or
+// watch_clear_pixel each) with the new one (one masked update per COM line from the tables glyph_masks.py generates).
+// Before timing anything, it draws every character in every position of both LCDs both ways, over a few different
+// backgrounds, and checks that the results match.
+//
+// The pixel functions are kept out of line, as they are on the watch, where they live in another translation unit.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// the parts of watch_slcd.h that watch_common_display.h leans on, without the rest of the watch library.
+typedef enum {
+    WATCH_LCD_TYPE_UNKNOWN = 0,
+    WATCH_LCD_TYPE_CLASSIC = 0b10101001,
+    WATCH_LCD_TYPE_CUSTOM = 0b01010110,
+} watch_lcd_type_t;
+#define WATCH_INDICATOR_COLON 7
+
+#include "watch_common_display.h"
+#include "watch_glyph_masks.h"
+
+#define NUM_COMS 4
+
+typedef enum {
+    LCD_CLASSIC = 0,
+    LCD_CUSTOM,
+} lcd_t;
+
+static uint32_t frame[NUM_COMS];
+
+__attribute__((noinline)) static void set_pixel(uint8_t com, uint8_t seg) {
+    frame[com] |= (uint32_t)1 << seg;
+}
+
+__attribute__((noinline)) static void clear_pixel(uint8_t com, uint8_t seg) {
+    frame[com] &= ~((uint32_t)1 << seg);
+}
+
+__attribute__((noinline)) static void update_pixels(uint8_t com, uint32_t clear_mask, uint32_t set_mask) {
+    frame[com] = (frame[com] & ~clear_mask) | set_mask;
+}
+
+// watch_display_character as it was before the tables.
+static void old_display_character(lcd_t lcd, uint8_t character, uint8_t position) {
+    if (lcd == LCD_CUSTOM) {
+        if (character == 'R' && position > 1 && position < 8) character = 'r';
+        else if (character == 'T' && position > 1 && position < 8) character = 't';
+    } else {
+        if (position == 4 || position == 6) {
+            if (character == '7') character = '&';
+            else if (character == 'A') character = 'a';
+            else if (character == 'o') character = 'O';
+            else if (character == 'L') character = '!';
+            else if (character == 'M' || character == 'm' || character == 'N') character = 'n';
+            else if (character == 'c') character = 'C';
+            else if (character == 'J') character = 'j';
+            else if (character == 'v' || character == 'V' || character == 'U' || character == 'W' || character == 'w') character = 'u';
+            else if (character == 't' || character == 'T') character = '+';
+        } else {
+            if (character == 'u') character = 'v';
+            else if (character == 'j') character = 'J';
+            else if (character == '.') character = '_';
+        }
+        if (position > 1) {
+            if (character == 'T') character = 't';
+        }
+        if (position == 1) {
+            if (character == 'a') character = 'A';
+            else if (character == 'o') character = 'O';
+            else if (character == 'i') character = 'l';
+            else if (character == 'n') character = 'N';
+            else if (character == 'r') character = 'R';
+            else if (character == 'd') character = 'D';
+            else if (character == 'v' || character == 'V' || character == 'u') character = 'U';
+            else if (character == 'b') character = 'B';
+            else if (character == 'c') character = 'C';
+        } else {
+            if (character == 'R') character = 'r';
+        }
+        if (position == 0) {
+            clear_pixel(0, 15);
+        } else {
+            if (character == 'I') character = 'l';
+        }
+    }
+
+    digit_mapping_t segmap;
+    uint8_t segdata;
+
+    if (lcd == LCD_CUSTOM) {
+        segmap = Custom_LCD_Display_Mapping[position];
+        segdata = Custom_LCD_Character_Set[character - 0x20];
+    } else {
+        segmap = Classic_LCD_Display_Mapping[position];
+        segdata = Classic_LCD_Character_Set[character - 0x20];
+    }
+
+    for (int i = 0; i < 8; i++) {
+        if (segmap.segment[i].value == segment_does_not_exist) {
+            segdata = segdata >> 1;
+            continue;
+        }
+        uint8_t com = segmap.segment[i].address.com;
+        uint8_t seg = segmap.segment[i].address.seg;
+
+        if (segdata & 1) set_pixel(com, seg);
+        else clear_pixel(com, seg);
+
+        segdata = segdata >> 1;
+    }
+
+    if (character == 'T' && position == 1) set_pixel(1, 12);
+    else if (position == 0 && (character == 'B' || character == 'D' || character == '@')) set_pixel(0, 15);
+    else if (position == 1 && (character == 'B' || character == 'D' || character == '@')) set_pixel(0, 12);
+}
+
+// watch_display_character as it is now, with just the parts of the display drivers it uses.
+static const watch_display_driver_t drivers[] = {
+    [LCD_CLASSIC] = {
+        .num_positions = CLASSIC_LCD_GLYPH_POSITIONS,
+        .num_coms = CLASSIC_LCD_GLYPH_COMS,
+        .glyph_clear = &Classic_LCD_Glyph_Clear[0][0],
+        .glyph_shift = Classic_LCD_Glyph_Shift,
+        .glyph_set = &Classic_LCD_Glyph_Set[0][0][0],
+    },
+    [LCD_CUSTOM] = {
+        .num_positions = CUSTOM_LCD_GLYPH_POSITIONS,
+        .num_coms = CUSTOM_LCD_GLYPH_COMS,
+        .glyph_clear = &Custom_LCD_Glyph_Clear[0][0],
+        .glyph_shift = Custom_LCD_Glyph_Shift,
+        .glyph_set = &Custom_LCD_Glyph_Set[0][0][0],
+    },
+};
+
+static void new_display_character(lcd_t lcd, uint8_t character, uint8_t position) {
+    const watch_display_driver_t *driver = &drivers[lcd];
+
+    if (position >= driver->num_positions) return;
+    if (character < WATCH_GLYPH_FIRST_CHARACTER || character > WATCH_GLYPH_LAST_CHARACTER) character = ' ';
+
+    const uint32_t *clear = driver->glyph_clear + position * driver->num_coms;
+    const uint16_t *set = driver->glyph_set + (position * WATCH_GLYPH_NUM_CHARACTERS + character - WATCH_GLYPH_FIRST_CHARACTER) * driver->num_coms;
+    uint8_t shift = driver->glyph_shift[position];
+    for (uint8_t com = 0; com < driver->num_coms; com++) {
+        update_pixels(com, clear[com], (uint32_t)set[com] << shift);
+    }
+}
+
+static uint32_t check(lcd_t lcd, uint8_t positions) {
+    const uint32_t backgrounds[] = { 0x00000000, 0xffffffff, 0x5a5a5a5a, 0xa5a5a5a5 };
+    uint32_t mismatches = 0;
+
+    for (uint8_t position = 0; position < positions; position++) {
+        for (uint8_t character = WATCH_GLYPH_FIRST_CHARACTER; character <= WATCH_GLYPH_LAST_CHARACTER; character++) {
+            for (size_t b = 0; b < sizeof(backgrounds) / sizeof(backgrounds[0]); b++) {
+                uint32_t expected[NUM_COMS];
+
+                for (uint8_t com = 0; com < NUM_COMS; com++) frame[com] = backgrounds[b];
+                old_display_character(lcd, character, position);
+                memcpy(expected, frame, sizeof(frame));
+                for (uint8_t com = 0; com < NUM_COMS; com++) frame[com] = backgrounds[b];
+                new_display_character(lcd, character, position);
+                if (memcmp(expected, frame, sizeof(frame))) {
+                    if (mismatches < 10) printf("mismatch: %s LCD, '%c' in position %d\n", lcd == LCD_CUSTOM ? "custom" : "classic", character, position);
+                    mismatches++;
+                }
+            }
+        }
+    }
+
+    return mismatches;
+}
+
+static double seconds_since(struct timespec *start) {
+    struct timespec end;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &end);
+    return (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static double characters_per_second(void (*display_character)(lcd_t, uint8_t, uint8_t), lcd_t lcd, uint8_t positions, uint32_t rounds) {
+    // what a clock face shows, give or take: a weekday, a date, and the time.
+    const char *text = "SA 61O:2345";
+    struct timespec t0;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t0);
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint8_t position = 0; position < positions; position++) display_character(lcd, text[position], position);
+    }
+
+    return (double)rounds * positions / seconds_since(&t0);
+}
+
+int main(void) {
+    const uint32_t rounds = 2000000;
+    uint32_t mismatches = check(LCD_CLASSIC, CLASSIC_LCD_GLYPH_POSITIONS) + check(LCD_CUSTOM, CUSTOM_LCD_GLYPH_POSITIONS);
+
+    printf("                   old chars/s      new chars/s    speedup\n");
+    for (lcd_t lcd = LCD_CLASSIC; lcd <= LCD_CUSTOM; lcd++) {
+        uint8_t positions = lcd == LCD_CUSTOM ? CUSTOM_LCD_GLYPH_POSITIONS : CLASSIC_LCD_GLYPH_POSITIONS;
+        double old_rate = characters_per_second(old_display_character, lcd, positions, rounds);
+        double new_rate = characters_per_second(new_display_character, lcd, positions, rounds);
+        printf("%-12s %16.0f %16.0f %9.2fx\n", lcd == LCD_CUSTOM ? "custom" : "classic", old_rate, new_rate, new_rate / old_rate);
+    }
+    printf("mismatches: %u\n", mismatches);
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+# MIT License
+#
+# Copyright (c) 2025 Joey Castillo
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Turns the output of the `trace` shell command into a timeline of what woke the watch, and how long it stayed up.
+#
+#   wake_trace.py [trace.txt]
+#
+# Paste the lines `trace` printed into a file (or pipe them in). Any line that isn't an entry is ignored, so it's fine to
+# include the prompt and the command itself.
+
+import argparse
+import base64
+import binascii
+import collections
+import datetime
+import struct
+import sys
+
+
+# movement_wake_trace_entry_t in movement.h: the RTC's date/time register, awake_ms, sources, face_index.
+ENTRY = struct.Struct("<IHBB")
+
+# movement_wake_source_t, in bit order.
+SOURCES = ["tick", "alarm", "button", "extwake", "accelerometer", "timer", "buzzer", "usb"]
+
+
+def decode_date_time(reg):
+    second = reg & 0x3f
+    minute = (reg >> 6) & 0x3f
+    hour = (reg >> 12) & 0x1f
+    day = (reg >> 17) & 0x1f
+    month = (reg >> 22) & 0xf
+    year = 2020 + ((reg >> 26) & 0x3f)
+    try:
+        return datetime.datetime(year, month, day, hour, minute, second)
+    except ValueError:
+        return None
+
+
+def decode_sources(bits):
+    names = [name for i, name in enumerate(SOURCES) if bits & (1 << i)]
+    return "+".join(names) if names else "-"
+
+
+def read_entries(lines):
+    entries = []
+    for line in lines:
+        line = line.strip()
+        if len(line) != 12:
+            continue
+        try:
+            raw = base64.b64decode(line, validate=True)
+        except binascii.Error:
+            continue
+        if len(raw) == ENTRY.size:
+            entries.append(ENTRY.unpack(raw))
+    return entries
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the watch's wake trace into a timeline.")
+    parser.add_argument("trace", nargs="?", type=argparse.FileType("r"), default=sys.stdin)
+    args = parser.parse_args()
+
+    entries = read_entries(args.trace)
+    if not entries:
+        sys.exit("no trace entries found")
+
+    awake_by_source = collections.Counter()
+    wakes_by_source = collections.Counter()
+    previous = None
+    print(f"{'woke at (UTC)':19}  {'since':>8}  {'awake':>7}  face  source")
+    for reg, awake_ms, sources, face_index in entries:
+        woke_at = decode_date_time(reg)
+        since = "" if previous is None or woke_at is None else f"{int((woke_at - previous).total_seconds())} s"
+        awake = f"{awake_ms} ms" if awake_ms < 0xffff else ">65 s"
+        when = woke_at.isoformat(sep=" ") if woke_at else f"{reg:#010x}"
+        print(f"{when:19}  {since:>8}  {awake:>7}  {face_index:4}  {decode_sources(sources)}")
+        if woke_at is not None:
+            previous = woke_at
+        wakes_by_source[decode_sources(sources)] += 1
+        awake_by_source[decode_sources(sources)] += awake_ms
+
+    print()
+    print(f"{'wakes':>6}  {'awake':>9}  source")
+    for source, count in wakes_by_source.most_common():
+        print(f"{count:6}  {awake_by_source[source]:6} ms  {source}")
+
+
+if __name__ == "__main__":
+    main()
@@ -139,7 +139,7 @@ void inver58_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(inver58_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(inver58_state_t));
         inver58_state_t *state = (inver58_state_t *)*context_ptr;
         state->signal_enabled = false;
         state->watch_face_index = watch_face_index;
@@ -201,9 +201,7 @@ bool inver58_face_loop(movement_event_t event, void *context) {
             // check the battery voltage once a week (on day change when day % 7 == 0)
             if (date_time.unit.day != state->last_battery_check && (date_time.unit.day % 7) == 0) {
                 state->last_battery_check = date_time.unit.day;
-                watch_enable_adc();
-                uint16_t voltage = watch_get_vcc_voltage();
-                watch_disable_adc();
+                uint16_t voltage = movement_get_cached_vcc_voltage();
                 state->battery_low = (voltage < 2200);
             }
 
@@ -161,7 +161,7 @@ static void turn_off_all(entrop1c_state_t *state) {
 void entrop1c_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        entrop1c_state_t *state = (entrop1c_state_t *)malloc(sizeof(entrop1c_state_t));
+        entrop1c_state_t *state = (entrop1c_state_t *)movement_alloc_face_context(sizeof(entrop1c_state_t));
         memset(state, 0, sizeof(*state));
         *context_ptr = state;
     }
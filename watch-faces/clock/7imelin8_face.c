@@ -72,7 +72,7 @@ static void set_lr_segments(uint8_t position, bool left_side) {
 void timelin8_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        timelin8_state_t *state = (timelin8_state_t *)malloc(sizeof(timelin8_state_t));
+        timelin8_state_t *state = (timelin8_state_t *)movement_alloc_face_context(sizeof(timelin8_state_t));
         state->last_bucket = -1;
         state->last_position = 255; // Invalid position
         state->last_minute = -1;
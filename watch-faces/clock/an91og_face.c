@@ -181,10 +181,11 @@ static void render_hour_ring(uint8_t hour_12, uint8_t subsecond, bool enable_bli
 }
 
 void an91og_face_setup(uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(ep_analog_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(ep_analog_state_t));
     }
+    // the low energy display only shows the time, so Movement can draw it ahead of time.
+    movement_set_low_energy_prerender(watch_face_index, true);
 }
 
 void an91og_face_activate(void *context) {
@@ -252,9 +253,12 @@ bool an91og_face_loop(movement_event_t event, void *context) {
             break;
         }
 
-        case EVENT_LOW_ENERGY_UPDATE: {
+        case EVENT_LOW_ENERGY_BEGIN:
             if (watch_sleep_animation_is_running()) watch_stop_sleep_animation();
             movement_request_tick_frequency(1);
+            break;
+
+        case EVENT_LOW_ENERGY_UPDATE: {
             watch_clear_display();
             watch_set_colon();
             
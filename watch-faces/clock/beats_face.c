@@ -33,7 +33,7 @@ void beats_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     (void) context_ptr;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(beats_face_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(beats_face_state_t));
     }
 }
 
@@ -50,16 +50,20 @@ static void clock_indicate(watch_indicator_t indicator, bool on) {
     }
 }
 
-static void clock_indicate_alarm() {
-    clock_indicate(WATCH_INDICATOR_SIGNAL, movement_alarm_enabled());
-}
-
 static void clock_indicate_time_signal(clock_state_t *state) {
     clock_indicate(WATCH_INDICATOR_BELL, state->time_signal_enabled);
 }
 
-static void clock_indicate_24h() {
-    clock_indicate(WATCH_INDICATOR_24H, !!movement_clock_mode_24h());
+static void clock_indicate_settings(clock_state_t *state) {
+    const uint8_t indicators = WATCH_INDICATOR_MASK(WATCH_INDICATOR_BELL) | WATCH_INDICATOR_MASK(WATCH_INDICATOR_SIGNAL) | WATCH_INDICATOR_MASK(WATCH_INDICATOR_24H);
+    uint8_t on = 0;
+
+    if (state->time_signal_enabled) on |= WATCH_INDICATOR_MASK(WATCH_INDICATOR_BELL);
+    if (movement_alarm_enabled()) on |= WATCH_INDICATOR_MASK(WATCH_INDICATOR_SIGNAL);
+    if (movement_clock_mode_24h()) on |= WATCH_INDICATOR_MASK(WATCH_INDICATOR_24H);
+
+    watch_clear_indicators(indicators & ~on);
+    watch_set_indicators(on);
 }
 
 static bool clock_is_pm(watch_date_time_t date_time) {
@@ -98,16 +102,22 @@ static void clock_check_battery_periodically(clock_state_t *state, watch_date_ti
 
     state->last_battery_check = date_time.unit.day;
 
-    uint16_t voltage = watch_get_vcc_voltage();
+    uint16_t voltage = movement_get_cached_vcc_voltage();
 
     state->battery_low = voltage < CLOCK_FACE_LOW_BATTERY_VOLTAGE_THRESHOLD;
 
     clock_indicate_low_available_power(state);
 }
 
+static void clock_update_advise_interest(clock_state_t *state) {
+    // the time signal only ever sounds at the top of the hour, so that's the only time we need to be asked.
+    movement_set_advise_interest(state->watch_face_index, state->time_signal_enabled ? MOVEMENT_ADVISE_HOURLY : MOVEMENT_ADVISE_NEVER, 0, 0);
+}
+
 static void clock_toggle_time_signal(clock_state_t *state) {
     state->time_signal_enabled = !state->time_signal_enabled;
     clock_indicate_time_signal(state);
+    clock_update_advise_interest(state);
 }
 
 static void clock_display_all(watch_date_time_t date_time) {
@@ -207,14 +217,16 @@ static void clock_stop_tick_tock_animation(void) {
 }
 
 void clock_face_setup(uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
-
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(clock_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(clock_state_t));
         clock_state_t *state = (clock_state_t *) *context_ptr;
         state->time_signal_enabled = false;
         state->watch_face_index = watch_face_index;
     }
+
+    clock_update_advise_interest((clock_state_t *) *context_ptr);
+    // the low energy display is just the time, so Movement can draw it ahead of time.
+    movement_set_low_energy_prerender(watch_face_index, true);
 }
 
 void clock_face_activate(void *context) {
@@ -222,9 +234,7 @@ void clock_face_activate(void *context) {
 
     clock_stop_tick_tock_animation();
 
-    clock_indicate_time_signal(state);
-    clock_indicate_alarm();
-    clock_indicate_24h();
+    clock_indicate_settings(state);
 
     watch_set_colon();
 
@@ -237,8 +247,10 @@ bool clock_face_loop(movement_event_t event, void *context) {
     watch_date_time_t current;
 
     switch (event.event_type) {
-        case EVENT_LOW_ENERGY_UPDATE:
+        case EVENT_LOW_ENERGY_BEGIN:
             clock_start_tick_tock_animation();
+            break;
+        case EVENT_LOW_ENERGY_UPDATE:
             clock_display_low_energy(movement_get_local_date_time());
             break;
         case EVENT_TICK:
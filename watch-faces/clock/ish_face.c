@@ -128,7 +128,7 @@ static void ish_face_stop_tick_tock_animation(void) {
 void ish_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(ish_face_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(ish_face_state_t));
         memset(*context_ptr, 0, sizeof(ish_face_state_t));
         ish_face_state_t *state = (ish_face_state_t *)*context_ptr;
         state->vagueness_level = 1; // Default to level 1 on initial load
@@ -144,6 +144,8 @@ void ish_face_activate(void *context) {
     ish_face_update_display(state, date_time);
     // Start colon blink at 500ms interval
     watch_start_indicator_blink_if_possible(WATCH_INDICATOR_COLON, 500);
+    // the colon blinks on its own, so we only need to hear from Movement once a minute.
+    movement_request_refresh_granularity(MOVEMENT_REFRESH_PER_MINUTE);
 }
 
 // Main event loop for the face
@@ -151,7 +153,7 @@ bool ish_face_loop(movement_event_t event, void *context) {
     ish_face_state_t *state = (ish_face_state_t *)context;
     switch (event.event_type) {
         case EVENT_TICK: {
-            // Check for updates every second
+            // Check for updates at the top of every minute
             watch_date_time_t date_time = movement_get_local_date_time();
             if (ish_face_should_update(state, date_time)) {
                 ish_face_update_display(state, date_time);
@@ -21,7 +21,7 @@ static void _update_alarm_indicator(bool settings_alarm_enabled, k91man_state_t
 
 void k91man_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(k91man_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(k91man_state_t));
         k91man_state_t *state = (k91man_state_t *)*context_ptr;
         state->signal_enabled = false;
         state->watch_face_index = watch_face_index;
@@ -52,9 +52,7 @@ void k91man_face_activate(void *context) {
     state->previous_day_date = 0xFF;
 
     // Initial battery check and indicator state
-    watch_enable_adc();
-    uint16_t voltage = watch_get_vcc_voltage();
-    watch_disable_adc();
+    uint16_t voltage = movement_get_cached_vcc_voltage();
     state->battery_low = (voltage < 2400); // align with clock face threshold
     if (state->battery_low) watch_set_indicator(WATCH_INDICATOR_LAP);
     else watch_clear_indicator(WATCH_INDICATOR_LAP);
@@ -136,9 +134,7 @@ bool k91man_face_loop(movement_event_t event, void *context) {
             // check the battery voltage once a week (on day change when day % 7 == 0)
             if (date_time.unit.day != state->last_battery_check && (date_time.unit.day % 7) == 0) {
                 state->last_battery_check = date_time.unit.day;
-                watch_enable_adc();
-                uint16_t voltage = watch_get_vcc_voltage();
-                watch_disable_adc();
+                uint16_t voltage = movement_get_cached_vcc_voltage();
                 state->battery_low = (voltage < 2400);
             }
             if (state->battery_low) watch_set_indicator(WATCH_INDICATOR_LAP);
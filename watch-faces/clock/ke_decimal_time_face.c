@@ -59,7 +59,7 @@ static void _display_time(ke_decimal_time_state_t *state, watch_date_time_t date
 void ke_decimal_time_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(ke_decimal_time_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(ke_decimal_time_state_t));
         memset(*context_ptr, 0, sizeof(ke_decimal_time_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -116,7 +116,7 @@ static void _update(mars_time_state_t *state, bool low_energy_mode) {
 void mars_time_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(mars_time_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(mars_time_state_t));
         memset(*context_ptr, 0, sizeof(mars_time_state_t));
     }
 }
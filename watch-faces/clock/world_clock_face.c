@@ -127,7 +127,7 @@ static void _update_timezone_offset(world_clock_state_t *state) {
 void world_clock_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(world_clock_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(world_clock_state_t));
         memset(*context_ptr, 0, sizeof(world_clock_state_t));
         world_clock_state_t *state = (world_clock_state_t *)*context_ptr;
         state->clock_index = world_clock_instances++;
@@ -99,7 +99,7 @@ static const int32_t clock_mapping[6][7][2] = {
 void wyoscan_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wyoscan_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(wyoscan_state_t));
         memset(*context_ptr, 0, sizeof(wyoscan_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
         wyoscan_state_t *state = (wyoscan_state_t *)*context_ptr;
@@ -208,7 +208,7 @@ void advanced_alarm_face_setup(uint8_t watch_face_index, void **context_ptr) {
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(alarm_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(alarm_state_t));
         alarm_state_t *state = (alarm_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(alarm_state_t));
         // initialize the default alarm values
@@ -303,6 +303,7 @@ bool advanced_alarm_face_loop(movement_event_t event, void *context) {
                     // revert change of enabled flag and show it briefly
                     state->alarm[state->alarm_idx].enabled ^= 1;
                     _alarm_set_signal(state);
+                    watch_display_commit();
                     delay_ms(275);
                     state->alarm_idx = 0;
                 }
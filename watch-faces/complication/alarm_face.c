@@ -50,6 +50,12 @@ static void _alarm_face_display_alarm_time(alarm_face_state_t *state) {
     watch_display_text(WATCH_POSITION_BOTTOM, lcdbuf);
 }
 
+static void _alarm_face_update_advise_interest(alarm_face_state_t *state) {
+    // we only need to be asked about the one minute of the day when the alarm goes off.
+    if (state->alarm_is_on) movement_set_advise_interest(state->watch_face_index, MOVEMENT_ADVISE_AT_TIME, state->hour, state->minute);
+    else movement_set_advise_interest(state->watch_face_index, MOVEMENT_ADVISE_NEVER, 0, 0);
+}
+
 static inline void button_beep() {
     // play a beep as confirmation for a button press (if applicable)
     if (movement_button_should_sound()) watch_buzzer_play_note_with_volume(BUZZER_NOTE_C7, 50, movement_button_volume());
@@ -60,16 +66,17 @@ static inline void button_beep() {
 //
 
 void alarm_face_setup(uint8_t watch_face_index, void **context_ptr) {
-    (void) watch_face_index;
-
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(alarm_face_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(alarm_face_state_t));
         alarm_face_state_t *state = (alarm_face_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(alarm_face_state_t));
 
         // default to an 8:00 AM alarm time.
         state->hour = 8;
+        state->watch_face_index = watch_face_index;
     }
+
+    _alarm_face_update_advise_interest((alarm_face_state_t *)*context_ptr);
 }
 
 void alarm_face_activate(void *context) {
@@ -77,7 +84,9 @@ void alarm_face_activate(void *context) {
     state->setting_mode = ALARM_FACE_SETTING_MODE_NONE;
 }
 void alarm_face_resign(void *context) {
-    (void) context;
+    alarm_face_state_t *state = (alarm_face_state_t *)context;
+    // the wearer may have left in the middle of changing the alarm time.
+    _alarm_face_update_advise_interest(state);
 }
 
 bool alarm_face_loop(movement_event_t event, void *context) {
@@ -119,6 +128,7 @@ bool alarm_face_loop(movement_event_t event, void *context) {
                     // also turn the alarm on since they just set it.
                     state->alarm_is_on = 1;
                     movement_set_alarm_enabled(true);
+                    _alarm_face_update_advise_interest(state);
                     watch_set_indicator(WATCH_INDICATOR_SIGNAL);
                     _alarm_face_display_alarm_time(state);
                     break;
@@ -135,6 +145,7 @@ bool alarm_face_loop(movement_event_t event, void *context) {
                     watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
                     movement_set_alarm_enabled(false);
                 }
+                _alarm_face_update_advise_interest(state);
             }
             break;
         case EVENT_ALARM_BUTTON_DOWN:
@@ -304,7 +304,7 @@ void baby_kicks_face_setup(uint8_t watch_face_index,
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(baby_kicks_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(baby_kicks_state_t));
         _reset(*context_ptr);
     }
 }
@@ -27,12 +27,6 @@
 #include "breathing_face.h"
 #include "watch.h"
 
-typedef struct {
-    uint8_t current_stage;
-    uint8_t indication_mode; // 0 = sound only, 1 = LED only, 2 = all off
-    uint8_t led_on_state; // 0 = LED off, 1 = LED on
-} breathing_state_t;
-
 static void update_indicators(breathing_state_t *state);
 
 const int NOTE_LENGTH = 80;
@@ -48,7 +42,7 @@ static const uint16_t OUT_HOLD_DUR[] = { NOTE_LENGTH, NOTE_LENGTH, NOTE_LENGTH }
 void breathing_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index; // Unused parameter
     if (*context_ptr == NULL) {
-        breathing_state_t *state = malloc(sizeof(breathing_state_t));
+        breathing_state_t *state = movement_alloc_face_context(sizeof(breathing_state_t));
         state->current_stage = 0;
         state->indication_mode = 0; // Start with sound only
         state->led_on_state = 0;
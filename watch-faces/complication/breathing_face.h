@@ -38,6 +38,12 @@
 
 #include "movement.h"
 
+typedef struct {
+    uint8_t current_stage;
+    uint8_t indication_mode; // 0 = sound only, 1 = LED only, 2 = all off
+    uint8_t led_on_state; // 0 = LED off, 1 = LED on
+} breathing_state_t;
+
 void breathing_face_setup(uint8_t watch_face_index, void ** context_ptr);
 void breathing_face_activate(void *context);
 bool breathing_face_loop(movement_event_t event, void *context);
@@ -36,13 +36,18 @@
 
 static bool quick_ticks_running;
 
+static void blink_selection(countdown_state_t *state) {
+    // the display blinks the field being set, so settings can stay at 1 Hz ticks.
+    static const watch_position_t fields[CD_SELECTIONS] = { WATCH_POSITION_HOURS, WATCH_POSITION_MINUTES, WATCH_POSITION_SECONDS };
+    watch_start_text_blink(fields[state->selection], 250);
+}
+
 static void abort_quick_ticks(countdown_state_t *state) {
     if (quick_ticks_running) {
         quick_ticks_running = false;
+        movement_request_tick_frequency(1);
         if (state->mode == cd_setting)
-            movement_request_tick_frequency(4);
-        else
-            movement_request_tick_frequency(1);
+            blink_selection(state);
     }
 }
 
@@ -94,7 +99,7 @@ static void start(countdown_state_t *state) {
 
 
 
-static void draw(countdown_state_t *state, uint8_t subsecond) {
+static void draw(countdown_state_t *state) {
     char buf[16];
 
     uint32_t delta;
@@ -120,21 +125,6 @@ static void draw(countdown_state_t *state, uint8_t subsecond) {
             break;
         case cd_setting:
             sprintf(buf, "%2d%02d%02d", state->hours, state->minutes, state->seconds);
-            if (!quick_ticks_running && subsecond % 2) {
-                switch(state->selection) {
-                    case 0:
-                        buf[0] = buf[1] = ' ';
-                        break;
-                    case 1:
-                        buf[2] = buf[3] = ' ';
-                        break;
-                    case 2:
-                        buf[4] = buf[5] = ' ';
-                        break;
-                    default:
-                        break;
-                }
-            }
             break;
     }
 
@@ -195,7 +185,7 @@ void countdown_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(countdown_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(countdown_state_t));
         countdown_state_t *state = (countdown_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(countdown_state_t));
         state->minutes = DEFAULT_MINUTES;
@@ -231,7 +221,7 @@ bool countdown_face_loop(movement_event_t event, void *context) {
         case EVENT_ACTIVATE:
             if (watch_sleep_animation_is_running()) watch_stop_sleep_animation();
             watch_display_text_with_fallback(WATCH_POSITION_TOP, "TIMER", "CD");
-            draw(state, event.subsecond);
+            draw(state);
             break;
         case EVENT_TICK:
             if (quick_ticks_running) {
@@ -250,7 +240,7 @@ bool countdown_face_loop(movement_event_t event, void *context) {
                 if (state->tap_detection_ticks == 0) movement_disable_tap_detection_if_available();
             }
 
-            draw(state, event.subsecond);
+            draw(state);
             break;
         case EVENT_MODE_BUTTON_UP:
             abort_quick_ticks(state);
@@ -272,12 +262,14 @@ bool countdown_face_loop(movement_event_t event, void *context) {
                         state->selection = 0;
                         state->mode = cd_reset;
                         store_countdown(state);
-                        movement_request_tick_frequency(1);
+                        watch_stop_blink();
                         button_beep();
+                    } else {
+                        blink_selection(state);
                     }
                     break;
             }
-            draw(state, event.subsecond);
+            draw(state);
             break;
         case EVENT_ALARM_BUTTON_UP:
             switch(state->mode) {
@@ -299,7 +291,7 @@ bool countdown_face_loop(movement_event_t event, void *context) {
                     settings_increment(state);
                     break;
             }
-            draw(state, event.subsecond);
+            draw(state);
             break;
         case EVENT_ALARM_LONG_PRESS:
             switch(state->mode) {
@@ -307,12 +299,13 @@ bool countdown_face_loop(movement_event_t event, void *context) {
                     // long press in reset mode enters settings
                     abort_tap_detection(state);
                     state->mode = cd_setting;
-                    movement_request_tick_frequency(4);
+                    blink_selection(state);
                     button_beep();
                     break;
                 case cd_setting:
                     // long press in settings mode starts quick ticks for adjusting the time
                     quick_ticks_running = true;
+                    watch_stop_blink();
                     movement_request_tick_frequency(8);
                     break;
                 case cd_running:
@@ -334,6 +327,7 @@ bool countdown_face_loop(movement_event_t event, void *context) {
                         state->seconds = 0;
                         break;
                 }
+                draw(state);
             } else {
                 // Toggle auto-repeat
                 button_beep();
@@ -355,7 +349,7 @@ bool countdown_face_loop(movement_event_t event, void *context) {
                 state->selection = 0;
                 state->mode = cd_reset;
                 store_countdown(state);
-                movement_request_tick_frequency(1);
+                watch_stop_blink();
             }
             if (state->mode != cd_running) {
                 movement_move_to_face(0);
@@ -385,7 +379,7 @@ bool countdown_face_loop(movement_event_t event, void *context) {
             }
             // reset the tap detection timer
             state->tap_detection_ticks = TAP_DETECTION_SECONDS;
-            draw(state, event.subsecond);
+            draw(state);
             break;
         default:
             movement_default_loop_handler(event);
@@ -401,6 +395,7 @@ void countdown_face_resign(void *context) {
         state->selection = 0;
         state->mode = cd_reset;
         store_countdown(state);
+        watch_stop_blink();
     }
 
     // return accelerometer to the state it was in before
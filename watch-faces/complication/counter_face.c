@@ -36,7 +36,7 @@ static inline bool lcd_is_custom(void) {
 void counter_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(counter_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(counter_state_t));
         memset(*context_ptr, 0, sizeof(counter_state_t));
         counter_state_t *state = (counter_state_t *)*context_ptr;
         state->beep_on = true;
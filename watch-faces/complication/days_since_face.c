@@ -97,7 +97,7 @@ static void _days_since_face_increment(days_since_state_t *state) {
 void days_since_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(days_since_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(days_since_state_t));
         memset(*context_ptr, 0, sizeof(days_since_state_t));
         days_since_date_t since_date = {0};
         days_since_state_t *state = (days_since_state_t *)*context_ptr;
@@ -128,6 +128,8 @@ void days_since_face_activate(void *context) {
     state->current_page = PAGE_DISPLAY;
     state->quick_cycle = false;
     state->ticks = 0;
+    // the count only changes at midnight, so a tick at the top of the minute is plenty.
+    movement_request_refresh_granularity(MOVEMENT_REFRESH_PER_MINUTE);
 }
 
 bool days_since_face_loop(movement_event_t event, void *context) {
@@ -220,7 +222,7 @@ bool days_since_face_loop(movement_event_t event, void *context) {
                     state->current_page = (state->current_page + 1) % 4;
                     if (state->current_page == PAGE_DISPLAY) {
                         // ...unless we've been pushed back to display mode.
-                        movement_request_tick_frequency(1);
+                        movement_request_refresh_granularity(MOVEMENT_REFRESH_PER_MINUTE);
                         // save the date if it changed
                         persist_date(state);
                         // and force display since it normally won't update til midnight.
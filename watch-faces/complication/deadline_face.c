@@ -566,7 +566,7 @@ void deadline_face_setup(uint8_t watch_face_index, void **context_ptr)
         return; /* Skip setup if context available */
 
     /* Allocate state */
-    *context_ptr = malloc(sizeof(deadline_state_t));
+    *context_ptr = movement_alloc_face_context(sizeof(deadline_state_t));
     memset(*context_ptr, 0, sizeof(deadline_state_t));
 
     /* Store face index for background tasks */
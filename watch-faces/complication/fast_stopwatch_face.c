@@ -47,11 +47,6 @@
 #include "tc.h"
 #endif
 
-// distant future for background task: January 1, 2083
-static const watch_date_time_t distant_future = {
-    .unit = {0, 0, 0, 1, 1, 63}
-};
-
 static uint32_t _ticks;
 static uint32_t _lap_ticks;
 static uint8_t _blink_ticks;
@@ -212,7 +207,7 @@ static inline void _set_colon() {
 void fast_stopwatch_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(fast_stopwatch_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(fast_stopwatch_state_t));
         memset(*context_ptr, 0, sizeof(fast_stopwatch_state_t));
         fast_stopwatch_state_t *state = (fast_stopwatch_state_t *)*context_ptr;
         _ticks = _lap_ticks = _blink_ticks = _old_minutes = _old_seconds = _hours = 0;
@@ -227,10 +222,6 @@ void fast_stopwatch_face_setup(uint8_t watch_face_index, void ** context_ptr) {
 
 void fast_stopwatch_face_activate(void *context) {
     (void) context;
-    if (_is_running) {
-        // The background task will keep the watch from entering low energy mode while the stopwatch is on screen.
-        movement_schedule_background_task(distant_future);
-    }
 }
 
 bool fast_stopwatch_face_loop(movement_event_t event, void *context) {
@@ -255,6 +246,8 @@ bool fast_stopwatch_face_loop(movement_event_t event, void *context) {
             break;
         case EVENT_TICK:
             _draw();
+            // keep the watch from entering low energy mode while the stopwatch is running on screen.
+            if (_is_running) movement_request_wake();
             break;
         case EVENT_LIGHT_LONG_PRESS:
             // kind od hidden feature: long press toggles light on or off
@@ -269,15 +262,11 @@ bool fast_stopwatch_face_loop(movement_event_t event, void *context) {
                 movement_request_tick_frequency(16);
                 // register 128 hz callback for time measuring
                 _cb_start();
-                // schedule the keepalive task when running
-                movement_schedule_background_task(distant_future);
             } else {
                 // stop the stopwatch
                 _cb_stop();
                 movement_request_tick_frequency(1);
                 _set_colon();
-                // cancel the keepalive task
-                movement_cancel_background_task();
             }
             _draw();
             _button_beep();
@@ -323,6 +312,4 @@ bool fast_stopwatch_face_loop(movement_event_t event, void *context) {
 
 void fast_stopwatch_face_resign(void *context) {
     (void) context;
-    // cancel the keepalive task
-    movement_cancel_background_task();
 }
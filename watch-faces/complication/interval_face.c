@@ -425,7 +425,7 @@ static void _resume_paused_timer(interval_face_state_t *state) {
 void interval_face_setup(uint8_t watch_face_index, void **context_ptr) {
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(interval_face_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(interval_face_state_t));
         interval_face_state_t *state = (interval_face_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(interval_face_state_t));
         state->face_idx = watch_face_index;
@@ -106,7 +106,7 @@ void kitchen_conversions_face_setup(uint8_t watch_face_index, void **context_ptr
     (void)watch_face_index;
     if (*context_ptr == NULL)
     {
-        *context_ptr = malloc(sizeof(kitchen_conversions_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(kitchen_conversions_state_t));
         memset(*context_ptr, 0, sizeof(kitchen_conversions_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
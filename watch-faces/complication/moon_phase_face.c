@@ -44,13 +44,15 @@ static const float phase_changes[] = {0, 1, 6.38264692644, 8.38264692644, 13.765
 void moon_phase_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(moon_phase_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(moon_phase_state_t));
         memset(*context_ptr, 0, sizeof(moon_phase_state_t));
     }
 }
 
 void moon_phase_face_activate(void *context) {
     (void) context;
+    // we only ever update at the top of the hour, so there's no need for a tick every second.
+    movement_request_refresh_granularity(MOVEMENT_REFRESH_PER_MINUTE);
 }
 
 static void _update(moon_phase_state_t *state, uint32_t offset) {
@@ -162,9 +164,9 @@ bool moon_phase_face_loop(movement_event_t event, void *context) {
             _update(state, state->offset);
             break;
         case EVENT_TICK:
-            // only update once an hour
+            // we tick once a minute; only update once an hour
             date_time = watch_rtc_get_date_time();
-            if ((date_time.unit.minute == 0) && (date_time.unit.second == 0)) _update(state, state->offset);
+            if (date_time.unit.minute == 0) _update(state, state->offset);
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             // update at the top of the hour OR if we're entering sleep mode with an offset.
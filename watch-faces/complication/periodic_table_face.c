@@ -44,7 +44,7 @@ void periodic_table_face_setup(uint8_t watch_face_index, void **context_ptr)
     (void)watch_face_index;
     if (*context_ptr == NULL)
     {
-        *context_ptr = malloc(sizeof(periodic_table_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(periodic_table_state_t));
         memset(*context_ptr, 0, sizeof(periodic_table_state_t));
     }
 }
@@ -48,13 +48,6 @@
 
 #define PULSOMETER_FACE_FREQUENCY (1 << PULSOMETER_FACE_FREQUENCY_FACTOR)
 
-typedef struct {
-    bool measuring;
-    int16_t pulses;
-    int16_t ticks;
-    int8_t calibration;
-} pulsometer_state_t;
-
 static inline bool lcd_is_custom(void) {
     return watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM;
 }
@@ -154,7 +147,7 @@ void pulsometer_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        pulsometer_state_t *pulsometer = malloc(sizeof(pulsometer_state_t));
+        pulsometer_state_t *pulsometer = movement_alloc_face_context(sizeof(pulsometer_state_t));
 
         pulsometer->calibration = PULSOMETER_FACE_CALIBRATION_DEFAULT;
         pulsometer->pulses = 0;
@@ -71,6 +71,13 @@
 
 #include "movement.h"
 
+typedef struct {
+    bool measuring;
+    int16_t pulses;
+    int16_t ticks;
+    int8_t calibration;
+} pulsometer_state_t;
+
 void pulsometer_face_setup(uint8_t watch_face_index, void ** context_ptr);
 void pulsometer_face_activate(void *context);
 bool pulsometer_face_loop(movement_event_t event,void *context);
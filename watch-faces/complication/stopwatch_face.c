@@ -29,16 +29,10 @@
 #include "watch.h"
 #include "watch_utility.h"
 
-// distant future for background task: January 1, 2083
-// see stopwatch_face_activate for details
-static const watch_date_time_t distant_future = {
-    .unit = {0, 0, 0, 1, 1, 63}
-};
-
 void stopwatch_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(stopwatch_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(stopwatch_state_t));
         memset(*context_ptr, 0, sizeof(stopwatch_state_t));
     }
 }
@@ -54,7 +48,6 @@ static void _stopwatch_face_update_display(stopwatch_state_t *stopwatch_state, b
     if (stopwatch_state->seconds_counted >= 3456000) {
         // display maxes out just shy of 40 days, thanks to the limit on the day digits (0-39)
         stopwatch_state->running = false;
-        movement_cancel_background_task();
         watch_display_text(WATCH_POSITION_TOP_RIGHT, "39");
         watch_display_text(WATCH_POSITION_BOTTOM, "235959");
         return;
@@ -80,16 +73,7 @@ static void _stopwatch_face_update_display(stopwatch_state_t *stopwatch_state, b
 void stopwatch_face_activate(void *context) {
     if (watch_sleep_animation_is_running()) watch_stop_sleep_animation();
 
-    stopwatch_state_t *stopwatch_state = (stopwatch_state_t *)context;
-    if (stopwatch_state->running) {
-        // because the low power update happens on the minute mark, and the wearer could start
-        // the stopwatch anytime, the low power update could fire up to 59 seconds later than
-        // we need it to, causing the stopwatch to display stale data.
-        // So let's schedule a background task that will never fire. This will keep the watch
-        // from entering low energy mode while the stopwatch is on screen. This background task
-        // will remain scheduled until the stopwatch stops OR this watch face resigns.
-        movement_schedule_background_task(distant_future);
-    }
+    (void) context;
 }
 
 bool stopwatch_face_loop(movement_event_t event, void *context) {
@@ -107,6 +91,11 @@ bool stopwatch_face_loop(movement_event_t event, void *context) {
             } else {
                 _stopwatch_face_update_display(stopwatch_state, true);
             }
+            // because the low power update happens on the minute mark, and the wearer could start
+            // the stopwatch anytime, the low power update could fire up to 59 seconds later than
+            // we need it to, causing the stopwatch to display stale data.
+            // So while the stopwatch is running on screen, keep the watch from entering low energy mode.
+            if (stopwatch_state->running) movement_request_wake();
             break;
         case EVENT_LIGHT_BUTTON_DOWN:
             movement_illuminate_led();
@@ -136,11 +125,6 @@ bool stopwatch_face_loop(movement_event_t event, void *context) {
                     // and resume from the "virtual" start time that's that many seconds ago.
                     stopwatch_state->start_time = watch_utility_date_time_from_unix_time(timestamp, 0);
                 }
-                // schedule our keepalive task when running...
-                movement_schedule_background_task(distant_future);
-            } else {
-                // and cancel it when stopped.
-                movement_cancel_background_task();
             }
             break;
         case EVENT_TIMEOUT:
@@ -168,8 +152,4 @@ bool stopwatch_face_loop(movement_event_t event, void *context) {
 
 void stopwatch_face_resign(void *context) {
     (void) context;
-
-    // regardless of whether we're running or stopped, cancel the task
-    // that was keeping us awake while on screen.
-    movement_cancel_background_task();
 }
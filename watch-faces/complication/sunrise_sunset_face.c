@@ -32,7 +32,6 @@
 #include "watch.h"
 #include "watch_utility.h"
 #include "watch_common_display.h"
-#include "filesystem.h"
 #include "sunriset.h"
 
 #if __EMSCRIPTEN__
@@ -41,23 +40,6 @@
 
 static const uint8_t _location_count = sizeof(longLatPresets) / sizeof(long_lat_presets_t);
 
-static void persist_location_to_filesystem(movement_location_t new_location) {
-    movement_location_t maybe_location = {0};
-
-    filesystem_read_file("location.u32", (char *) &maybe_location.reg, sizeof(movement_location_t));
-    if (new_location.reg != maybe_location.reg) {
-        filesystem_write_file("location.u32", (char *) &new_location.reg, sizeof(movement_location_t));
-    }
-}
-
-static movement_location_t load_location_from_filesystem() {
-    movement_location_t location = {0};
-
-    filesystem_read_file("location.u32", (char *) &location.reg, sizeof(movement_location_t));
-
-    return location;
-}
-
 static void _sunrise_sunset_set_expiration(sunrise_sunset_state_t *state, watch_date_time_t next_rise_set) {
     uint32_t timestamp = watch_utility_date_time_to_unix_time(next_rise_set, 0);
     state->rise_set_expires = watch_utility_date_time_from_unix_time(timestamp + 60, 0);
@@ -69,7 +51,7 @@ static void _sunrise_sunset_face_update(sunrise_sunset_state_t *state) {
     bool show_next_match = false;
     movement_location_t movement_location;
     if (state->longLatToUse == 0 || _location_count <= 1)
-        movement_location = load_location_from_filesystem();
+        movement_location = movement_get_location();
     else{
         movement_location.bit.latitude = longLatPresets[state->longLatToUse].latitude;
         movement_location.bit.longitude = longLatPresets[state->longLatToUse].longitude;
@@ -243,7 +225,7 @@ static void _sunrise_sunset_face_update_location_register(sunrise_sunset_state_t
         int16_t lon = _sunrise_sunset_face_latlon_from_struct(state->working_longitude);
         movement_location.bit.latitude = lat;
         movement_location.bit.longitude = lon;
-        persist_location_to_filesystem(movement_location);
+        movement_set_location(movement_location);
         state->location_changed = false;
     }
 }
@@ -454,7 +436,7 @@ static void _sunrise_sunset_face_advance_digit(sunrise_sunset_state_t *state) {
 void sunrise_sunset_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(sunrise_sunset_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(sunrise_sunset_state_t));
         memset(*context_ptr, 0, sizeof(sunrise_sunset_state_t));
     }
 }
@@ -469,16 +451,16 @@ void sunrise_sunset_face_activate(void *context) {
     int16_t browser_lon = EM_ASM_INT({
         return lon;
     });
-    if ((watch_get_backup_data(1) == 0) && (browser_lat || browser_lon)) {
+    if ((movement_get_location().reg == 0) && (browser_lat || browser_lon)) {
         movement_location_t browser_loc;
         browser_loc.bit.latitude = browser_lat;
         browser_loc.bit.longitude = browser_lon;
-        watch_store_backup_data(browser_loc.reg, 1);
+        movement_set_location(browser_loc);
     }
 #endif
 
     sunrise_sunset_state_t *state = (sunrise_sunset_state_t *)context;
-    movement_location_t movement_location = load_location_from_filesystem();
+    movement_location_t movement_location = movement_get_location();
     state->working_latitude = _sunrise_sunset_face_struct_from_latlon(movement_location.bit.latitude);
     state->working_longitude = _sunrise_sunset_face_struct_from_latlon(movement_location.bit.longitude);
 }
@@ -573,7 +555,7 @@ bool sunrise_sunset_face_loop(movement_event_t event, void *context) {
             }
             break;
         case EVENT_TIMEOUT:
-            if (load_location_from_filesystem().reg == 0) {
+            if (movement_get_location().reg == 0) {
                 // if no location set, return home
                 movement_move_to_face(0);
             } else if (state->page || state->rise_index) {
@@ -53,7 +53,7 @@ static const int16_t _tally_default[] = {
 void tally_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tally_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(tally_state_t));
         memset(*context_ptr, 0, sizeof(tally_state_t));
         tally_state_t *state = (tally_state_t *)*context_ptr;
         state->tally_default_idx = 0;
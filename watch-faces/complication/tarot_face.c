@@ -278,7 +278,7 @@ static void display_animation(tarot_state_t *state) {
 void tarot_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tarot_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(tarot_state_t));
         memset(*context_ptr, 0, sizeof(tarot_state_t));
     }
     // Emulator only: Seed random number generator
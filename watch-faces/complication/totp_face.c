@@ -37,13 +37,10 @@
 #include "totp_face.h"
 #include "watch.h"
 #include "watch_utility.h"
+#include "watch_display_format.h"
 #include "TOTP.h"
 #include "base32.h"
 
-#ifndef TOTP_FACE_MAX_KEY_LENGTH
-#define TOTP_FACE_MAX_KEY_LENGTH 128
-#endif
-
 typedef struct {
     unsigned char labels[2];
     hmac_alg algorithm;
@@ -124,7 +121,9 @@ static void totp_display_error(totp_state_t *totp_state) {
     char buf[10 + 1];
     totp_t *totp = totp_current(totp_state);
 
-    snprintf(buf, sizeof(buf), "%c%c  ERROR ", totp->labels[0], totp->labels[1]);
+    buf[0] = totp->labels[0];
+    buf[1] = totp->labels[1];
+    strcpy(buf + 2, "  ERROR ");
     watch_display_text(0, buf);
 }
 
@@ -140,7 +139,12 @@ static void totp_display_code(totp_state_t *totp_state) {
         totp_state->steps = result.quot;
     }
     valid_for = totp->period - result.rem;
-    sprintf(buf, "%c%c%2d%06lu", totp->labels[0], totp->labels[1], valid_for, totp_state->current_code);
+    char *p = buf;
+    *p++ = totp->labels[0];
+    *p++ = totp->labels[1];
+    p = watch_format_unsigned(p, valid_for, 2, ' ');
+    p = watch_format_unsigned(p, totp_state->current_code, 6, '0');
+    *p = '\0';
 
     watch_display_text(0, buf);
 }
@@ -168,8 +172,8 @@ void totp_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     totp_validate_key_lengths();
 
     if (*context_ptr == NULL) {
-        totp_state_t *totp = malloc(sizeof(totp_state_t));
-        totp->current_decoded_key = malloc(TOTP_FACE_MAX_KEY_LENGTH);
+        totp_state_t *totp = movement_alloc_face_context(sizeof(totp_state_t));
+        totp->current_decoded_key = movement_alloc_face_context(TOTP_FACE_MAX_KEY_LENGTH);
         *context_ptr = totp;
     }
 }
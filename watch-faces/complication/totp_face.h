@@ -69,6 +69,10 @@
 
 #include "movement.h"
 
+#ifndef TOTP_FACE_MAX_KEY_LENGTH
+#define TOTP_FACE_MAX_KEY_LENGTH 128
+#endif
+
 typedef struct {
     uint32_t timestamp;
     uint8_t steps;
@@ -193,7 +193,7 @@ static void totp_lfs_face_read_file(char *filename) {
 void totp_lfs_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(totp_lfs_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(totp_lfs_state_t));
     }
 
 #if !(__EMSCRIPTEN__)
@@ -31,7 +31,7 @@ void wareki_setup(uint8_t watch_face_index, void ** context_ptr) {
     //printf("wareki_setup() \n");
     
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wareki_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(wareki_state_t));
         memset(*context_ptr, 0, sizeof(wareki_state_t));
 
         //debug code 
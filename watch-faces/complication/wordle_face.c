@@ -532,7 +532,7 @@ static void _activate(wordle_state_t *state) {
 void wordle_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wordle_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(wordle_state_t));
         memset(*context_ptr, 0, sizeof(wordle_state_t));
         wordle_state_t *state = (wordle_state_t *)*context_ptr;
         state->curr_screen = WORDLE_SCREEN_TITLE;
@@ -30,7 +30,7 @@
 
 void character_set_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(char));
+    if (*context_ptr == NULL) *context_ptr = movement_alloc_face_context(sizeof(char));
 }
 
 void character_set_face_activate(void *context) {
@@ -33,7 +33,7 @@
 void peek_memory_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(peek_memory_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(peek_memory_state_t));
         peek_memory_state_t *state = (peek_memory_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(peek_memory_state_t));
 #if __EMSCRIPTEN__
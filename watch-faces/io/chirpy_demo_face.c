@@ -28,33 +28,6 @@
 #include "chirpy_tx.h"
 #include "filesystem.h"
 
-typedef enum {
-    CDM_CHOOSE = 0,
-    CDM_CHIRPING,
-} chirpy_demo_mode_t;
-
-typedef enum {
-    CDP_CLEAR = 0,
-    CDP_INFO_SHORT,
-    CDP_INFO_LONG,
-    CDP_INFO_NANOSEC,
-} chirpy_demo_program_t;
-
-typedef struct {
-    // Current mode
-    chirpy_demo_mode_t mode;
-
-    // Selected program
-    chirpy_demo_program_t program;
-
-    // Helps us handle 1/64 ticks during transmission; including countdown timer
-    chirpy_tick_state_t tick_state;
-
-    // Used by chirpy encoder during transmission
-    chirpy_encoder_state_t encoder_state;
-
-} chirpy_demo_state_t;
-
 static uint8_t long_data_str[] =
     "There once was a ship that put to sea\n"
     "The name of the ship was the Billy of Tea\n"
@@ -99,7 +72,7 @@ static uint16_t activity_buffer_size = 0;
 void chirpy_demo_face_setup(uint8_t watch_face_index, void **context_ptr) {
     (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(chirpy_demo_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(chirpy_demo_state_t));
         memset(*context_ptr, 0, sizeof(chirpy_demo_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -36,7 +36,7 @@
 void irda_upload_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(irda_demo_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(irda_demo_state_t));
         memset(*context_ptr, 0, sizeof(irda_demo_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }    
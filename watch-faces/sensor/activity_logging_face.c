@@ -28,6 +28,7 @@
 #include "filesystem.h"
 #include "watch.h"
 #include "watch_utility.h"
+#include "watch_display_format.h"
 
 static void _activity_logging_face_update_display(activity_logging_state_t *state) {
     char buf[8];
@@ -37,9 +38,8 @@ static void _activity_logging_face_update_display(activity_logging_state_t *stat
 
     if (state->display_index == 0) {
         // if we are at today, just show the count so far
-        snprintf(buf, 8, "%2d", timestamp.unit.day);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-        snprintf(buf, 8, "%4d  ", state->active_minutes_today);
+        watch_display_unsigned(WATCH_POSITION_TOP_RIGHT, timestamp.unit.day, ' ');
+        strcpy(watch_format_unsigned(buf, state->active_minutes_today, 4, ' '), "  ");
         watch_display_text(WATCH_POSITION_BOTTOM, buf);
 
         // also indicate that this is the active day — we are still sensing active minutes!
@@ -54,15 +54,14 @@ static void _activity_logging_face_update_display(activity_logging_state_t *stat
         timestamp = watch_utility_date_time_from_unix_time(unixtime, movement_get_current_timezone_offset());    
 
         // display date
-        snprintf(buf, 8, "%2d", timestamp.unit.day);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+        watch_display_unsigned(WATCH_POSITION_TOP_RIGHT, timestamp.unit.day, ' ');
 
         if (pos < 0) {
             // no data at this index
             watch_display_text(WATCH_POSITION_BOTTOM, "no dat");
         } else {
             // we are displaying the number active minutes
-            snprintf(buf, 8, "%4d  ", state->activity_log[pos]);
+            strcpy(watch_format_unsigned(buf, state->activity_log[pos], 4, ' '), "  ");
             watch_display_text(WATCH_POSITION_BOTTOM, buf);
         }
     }
@@ -71,7 +70,7 @@ static void _activity_logging_face_update_display(activity_logging_state_t *stat
 void activity_logging_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(activity_logging_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(activity_logging_state_t));
         memset(*context_ptr, 0, sizeof(activity_logging_state_t));
         // At first run, tell Movement to run the accelerometer in the background. It will now run at this rate forever.
         movement_set_accelerometer_background_rate(LIS2DW_DATA_RATE_LOWEST);
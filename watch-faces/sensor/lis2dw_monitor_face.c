@@ -32,7 +32,7 @@
 #define DISPLAY_FREQUENCY 8
 
 /* Settings */
-#define NUM_SETTINGS 7
+#define NUM_SETTINGS LIS2DW_MONITOR_FACE_NUM_SETTINGS
 
 static void _settings_title_display(lis2dw_monitor_state_t *state, char *buf1, char *buf2)
 {
@@ -531,7 +531,7 @@ void lis2dw_monitor_face_setup(uint8_t watch_face_index, void **context_ptr)
 {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(lis2dw_monitor_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(lis2dw_monitor_state_t));
         memset(*context_ptr, 0, sizeof(lis2dw_monitor_state_t));
     }
     lis2dw_monitor_state_t *state = (lis2dw_monitor_state_t *) * context_ptr;
@@ -541,7 +541,8 @@ void lis2dw_monitor_face_setup(uint8_t watch_face_index, void **context_ptr)
 
     /* Initialize settings */
     uint8_t settings_page = 0;
-    state->settings = malloc(NUM_SETTINGS * sizeof(lis2dw_settings_t));
+    if (state->settings == NULL)
+        state->settings = movement_alloc_face_context(LIS2DW_MONITOR_FACE_NUM_SETTINGS * sizeof(lis2dw_settings_t));
     state->settings[settings_page].display = _settings_mode_display;
     state->settings[settings_page].advance = _settings_mode_advance;
     settings_page++;
@@ -36,6 +36,8 @@
 
 #include "movement.h"
 
+#define LIS2DW_MONITOR_FACE_NUM_SETTINGS 7
+
 typedef enum {
     PAGE_LIS2DW_MONITOR,
     PAGE_LIS2DW_SETTINGS,
@@ -29,8 +29,8 @@
 
 static bool skip = false;
 
-static void _temperature_display_face_update_display(bool in_fahrenheit) {
-    float temperature_c = movement_get_temperature();
+static void _temperature_display_face_update_display(bool in_fahrenheit, uint32_t max_age) {
+    float temperature_c = movement_get_temperature_no_older_than(max_age);
     if (in_fahrenheit) {
         watch_display_float_with_best_effort(temperature_c * 1.8 + 32.0, "#F");
     } else {
@@ -55,7 +55,7 @@ bool temperature_display_face_loop(movement_event_t event, void *context) {
     switch (event.event_type) {
         case EVENT_ALARM_LONG_PRESS:
             movement_set_use_imperial_units(!movement_use_imperial_units());
-            _temperature_display_face_update_display(movement_use_imperial_units());
+            _temperature_display_face_update_display(movement_use_imperial_units(), 0);
             break;
         case EVENT_ACTIVATE:
             if (skip) {
@@ -74,7 +74,7 @@ bool temperature_display_face_loop(movement_event_t event, void *context) {
                 // In reality the measurement takes a fraction of a second, but this is just to show something is happening.
                 watch_set_indicator(WATCH_INDICATOR_SIGNAL);
             } else if (date_time.unit.second % 5 == 0) {
-                _temperature_display_face_update_display(movement_use_imperial_units());
+                _temperature_display_face_update_display(movement_use_imperial_units(), 0);
                 watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
             }
             break;
@@ -86,7 +86,7 @@ bool temperature_display_face_loop(movement_event_t event, void *context) {
             // update every 5 minutes
             if (date_time.unit.minute % 5 == 0) {
                 watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
-                _temperature_display_face_update_display(movement_use_imperial_units());
+                _temperature_display_face_update_display(movement_use_imperial_units(), 60);
             }
             break;
         default:
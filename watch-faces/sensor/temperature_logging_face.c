@@ -26,6 +26,7 @@
 #include <string.h>
 #include "temperature_logging_face.h"
 #include "watch.h"
+#include "watch_display_format.h"
 
 static bool skip = false;
 
@@ -34,7 +35,7 @@ static void _temperature_logging_face_log_data(temperature_logging_state_t *logg
     size_t pos = logger_state->data_points % TEMPERATURE_LOGGING_NUM_DATA_POINTS;
 
     logger_state->data[pos].timestamp.reg = date_time.reg;
-    logger_state->data[pos].temperature_c = movement_get_temperature();
+    logger_state->data[pos].temperature_c = movement_get_cached_temperature();
     logger_state->data_points++;
 }
 
@@ -50,8 +51,7 @@ static void _temperature_logging_face_update_display(temperature_logging_state_t
         // no data at this index
         watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LOG", "TL");
         watch_display_text(WATCH_POSITION_BOTTOM, "no dat");
-        sprintf(buf, "%2d", logger_state->display_index);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+        watch_display_unsigned(WATCH_POSITION_TOP_RIGHT, logger_state->display_index, ' ');
     } else if (logger_state->ts_ticks) {
         // we are displaying the timestamp in response to a button press
         watch_date_time_t date_time = logger_state->data[pos].timestamp;
@@ -64,15 +64,13 @@ static void _temperature_logging_face_update_display(temperature_logging_state_t
             if (date_time.unit.hour == 0) date_time.unit.hour = 12;
         }
         watch_display_text(WATCH_POSITION_TOP_LEFT, "AT");
-        sprintf(buf, "%2d", date_time.unit.day);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
-        sprintf(buf, "%2d%02d%02d", date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
+        watch_display_unsigned(WATCH_POSITION_TOP_RIGHT, date_time.unit.day, ' ');
+        *watch_format_time(buf, date_time.unit.hour, date_time.unit.minute, date_time.unit.second, ' ') = '\0';
         watch_display_text(WATCH_POSITION_BOTTOM, buf);
     } else {
         // we are displaying the temperature
         watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "LOG", "TL");
-        sprintf(buf, "%2d", logger_state->display_index);
-        watch_display_text(WATCH_POSITION_TOP_RIGHT, buf);
+        watch_display_unsigned(WATCH_POSITION_TOP_RIGHT, logger_state->display_index, ' ');
         if (in_fahrenheit) {
             watch_display_float_with_best_effort(logger_state->data[pos].temperature_c * 1.8 + 32.0, "#F");
         } else {
@@ -82,13 +80,14 @@ static void _temperature_logging_face_update_display(temperature_logging_state_t
 }
 
 void temperature_logging_face_setup(uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
 
     // if temperature is invalid, we don't have a temperature sensor which means we shouldn't be here.
     if (movement_get_temperature() == 0xFFFFFFFF) skip = true;
+    // otherwise have Movement take a reading at the top of every hour, in time for our background task.
+    else movement_set_sensor_interest(watch_face_index, MOVEMENT_SENSOR_TEMPERATURE, 60);
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(temperature_logging_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(temperature_logging_state_t));
         memset(*context_ptr, 0, sizeof(temperature_logging_state_t));
     }
 }
@@ -149,8 +148,8 @@ movement_watch_face_advisory_t temperature_logging_face_advise(void *context) {
     movement_watch_face_advisory_t retval = { 0 };
 
     // this will get called at the top of each minute, so all we check is if we're at the top of the hour as well.
-    // if we are, we ask for a background task.
-    retval.wants_background_task = watch_rtc_get_date_time().unit.minute == 0;
+    // if we are, we ask for a background task. local time, since that's when Movement takes our hourly reading.
+    retval.wants_background_task = movement_get_local_date_time().unit.minute == 0;
 
     return retval;
 }
@@ -27,8 +27,8 @@
 #include "voltage_face.h"
 #include "watch.h"
 
-static void _voltage_face_update_display(void) {
-    float voltage = (float)watch_get_vcc_voltage() / 1000.0;
+static void _voltage_face_update_display(uint32_t max_age) {
+    float voltage = (float)movement_get_vcc_voltage_no_older_than(max_age) / 1000.0;
 
     watch_display_text_with_fallback(WATCH_POSITION_TOP_LEFT, "BAT", "BA");
     watch_display_float_with_best_effort(voltage, " V");
@@ -49,18 +49,19 @@ bool voltage_face_loop(movement_event_t event, void *context) {
     switch (event.event_type) {
         case EVENT_ACTIVATE:
             if (watch_sleep_animation_is_running()) watch_stop_sleep_animation();
-            _voltage_face_update_display();
+            _voltage_face_update_display(0);
             break;
         case EVENT_TICK:
             date_time = movement_get_local_date_time();
             if (date_time.unit.second % 5 == 4) {
                 watch_set_indicator(WATCH_INDICATOR_SIGNAL);
             } else if (date_time.unit.second % 5 == 0) {
-                _voltage_face_update_display();
+                _voltage_face_update_display(0);
                 watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
             }
             break;
         case EVENT_LOW_ENERGY_UPDATE:
+            date_time = movement_get_local_date_time();
             // clear seconds area (on classic LCD) and start tick animation if necessary
             if (!watch_sleep_animation_is_running()) {
                 watch_display_text_with_fallback(WATCH_POSITION_SECONDS, " V", "  ");
@@ -69,7 +70,7 @@ bool voltage_face_loop(movement_event_t event, void *context) {
             // update once an hour
             if (date_time.unit.minute == 0) {
                 watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
-                _voltage_face_update_display();
+                _voltage_face_update_display(60);
                 watch_display_text_with_fallback(WATCH_POSITION_SECONDS, " V", "  ");
             }
             break;
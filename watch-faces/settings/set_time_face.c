@@ -76,7 +76,7 @@ static void _abort_quick_ticks() {
 
 void set_time_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(uint8_t));
+    if (*context_ptr == NULL) *context_ptr = movement_alloc_face_context(sizeof(uint8_t));
 }
 
 void set_time_face_activate(void *context) {
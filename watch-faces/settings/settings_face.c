@@ -231,25 +231,12 @@ static void git_hash_setting_advance(void) {
 void settings_face_setup(uint8_t watch_face_index, void ** context_ptr) {
     (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(settings_state_t));
+        *context_ptr = movement_alloc_face_context(sizeof(settings_state_t));
         settings_state_t *state = (settings_state_t *)*context_ptr;
         int8_t current_setting = 0;
 
-        state->num_settings = 5; // baseline, without LED settings
-#ifdef BUILD_GIT_HASH
-        state->num_settings++;
-#endif
-#ifdef WATCH_RED_TCC_CHANNEL
-        state->num_settings++;
-#endif
-#ifdef WATCH_GREEN_TCC_CHANNEL
-        state->num_settings++;
-#endif
-#ifdef WATCH_BLUE_TCC_CHANNEL
-        state->num_settings++;
-#endif
-
-        state->settings_screens = malloc(state->num_settings * sizeof(settings_screen_t));
+        state->num_settings = SETTINGS_FACE_NUM_SCREENS;
+        state->settings_screens = movement_alloc_face_context(SETTINGS_FACE_NUM_SCREENS * sizeof(settings_screen_t));
         state->settings_screens[current_setting].display = clock_setting_display;
         state->settings_screens[current_setting].advance = clock_setting_advance;
         current_setting++;
@@ -77,6 +77,31 @@ typedef struct {
     void (*advance)();
 } settings_screen_t;
 
+// setup allocates a screen for each of the five settings every build has, plus the build's git hash and each color of
+// LED, when there are any. Movement sizes the face arena from this when building.
+#ifdef BUILD_GIT_HASH
+#define SETTINGS_FACE_GIT_HASH_SCREENS 1
+#else
+#define SETTINGS_FACE_GIT_HASH_SCREENS 0
+#endif
+#ifdef WATCH_RED_TCC_CHANNEL
+#define SETTINGS_FACE_RED_LED_SCREENS 1
+#else
+#define SETTINGS_FACE_RED_LED_SCREENS 0
+#endif
+#ifdef WATCH_GREEN_TCC_CHANNEL
+#define SETTINGS_FACE_GREEN_LED_SCREENS 1
+#else
+#define SETTINGS_FACE_GREEN_LED_SCREENS 0
+#endif
+#ifdef WATCH_BLUE_TCC_CHANNEL
+#define SETTINGS_FACE_BLUE_LED_SCREENS 1
+#else
+#define SETTINGS_FACE_BLUE_LED_SCREENS 0
+#endif
+#define SETTINGS_FACE_NUM_SCREENS (5 + SETTINGS_FACE_GIT_HASH_SCREENS + SETTINGS_FACE_RED_LED_SCREENS + \
+                                   SETTINGS_FACE_GREEN_LED_SCREENS + SETTINGS_FACE_BLUE_LED_SCREENS)
+
 typedef struct {
     int8_t current_page;
     int8_t num_settings;
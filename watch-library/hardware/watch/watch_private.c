@@ -143,3 +143,18 @@ void watch_reset_to_bootloader(void) {
     *dbl_tap_ptr = 0xf01669ef; // from the UF2 bootloaer: uf2.h line 255
     NVIC_SystemReset();
 }
+
+static uint8_t _critical_section_depth = 0;
+static uint32_t _critical_section_primask;
+
+void watch_enter_critical_section(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    // only the outermost call gets to decide whether interrupts come back on.
+    if (_critical_section_depth++ == 0) _critical_section_primask = primask;
+}
+
+void watch_exit_critical_section(void) {
+    if (_critical_section_depth == 0) return;
+    if (--_critical_section_depth == 0 && !_critical_section_primask) __enable_irq();
+}
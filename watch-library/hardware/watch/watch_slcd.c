@@ -23,6 +23,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "delay.h"
 #include "usb.h"
 #include "pins.h"
@@ -40,6 +41,20 @@ static uint16_t _slcd_fc_min_ms_bypass = 0;
 
 static watch_lcd_type_t _installed_display = WATCH_LCD_TYPE_UNKNOWN;
 
+// everything draws into _shadow; watch_display_commit copies the words that differ from _committed to the SLCD.
+static watch_display_frame_t _shadow;
+static watch_display_frame_t _committed;
+// when a face is drawing ahead of time, pixels go here instead.
+static watch_display_frame_t *_draw_target = &_shadow;
+// segments run by frame counter 2. With no frames they blink, dark on odd steps; with frames, each step shows the next
+// frame in them. Either way _committed still holds what was drawn there; only the SLCD registers see the difference.
+static watch_display_frame_t _fc2_segments;
+static const watch_display_frame_t *_fc2_frames = NULL;
+static uint8_t _fc2_num_frames = 0;
+static bool _fc2_loop = false;
+static volatile uint8_t _fc2_step = 0;
+static volatile bool _fc2_running = false;
+
 /// NOTE: The function below was commented out because LCD autodetection proved unreliable.
 /// While I would love to fix it, I can't figure it out in time for the product launch.
 /// Instead, this function simply implements the failsafe: red LED glows until one of two
@@ -48,10 +63,11 @@ static watch_lcd_type_t _installed_display = WATCH_LCD_TYPE_UNKNOWN;
 void watch_discover_lcd_type(void) {
     #if defined(FORCE_CUSTOM_LCD_TYPE)
     _installed_display = WATCH_LCD_TYPE_CUSTOM;
-    _watch_update_indicator_segments();
+    _watch_display_install_driver(_installed_display);
     return;
     #elif defined(FORCE_CLASSIC_LCD_TYPE)
     _installed_display = WATCH_LCD_TYPE_CLASSIC;
+    _watch_display_install_driver(_installed_display);
     return;
     #endif
 
@@ -89,7 +105,7 @@ void watch_discover_lcd_type(void) {
     watch_disable_leds();
 
     // Update indicator segment mapping based on the detected display (they are v different).
-    _watch_update_indicator_segments();
+    _watch_display_install_driver(_installed_display);
 }
 
 /*
@@ -191,7 +207,7 @@ void watch_discover_lcd_type(void) {
     }
 
 valid_display_detected:
-    _watch_update_indicator_segments();
+    _watch_display_install_driver(_installed_display);
 }
 
 */
@@ -250,6 +266,8 @@ void watch_enable_display(void) {
     _slcd_fc_min_ms_bypass = 32 * (1000 / _slcd_framerate);
 
     slcd_clear();
+    memset(&_shadow, 0, sizeof(_shadow));
+    memset(&_committed, 0, sizeof(_committed));
 
     if (_installed_display == WATCH_LCD_TYPE_CUSTOM) {
         slcd_set_contrast(4);
@@ -260,30 +278,80 @@ void watch_enable_display(void) {
     slcd_enable();
 }
 
-inline void watch_set_pixel(uint8_t com, uint8_t seg) {
-    slcd_set_segment(com, seg);
+// the segment data registers for each COM line, SDATALn and SDATAHn, sit next to each other; we only use the low word.
+static inline volatile uint32_t *_watch_slcd_sdatal(uint8_t com) {
+    return &SLCD->SDATAL0.reg + com * 2;
+}
+
+void watch_set_pixel(uint8_t com, uint8_t seg) {
+    if (com >= WATCH_DISPLAY_FRAME_COMS || seg >= 32) return;
+    _draw_target->com[com] |= (uint32_t)1 << seg;
 }
 
-inline void watch_clear_pixel(uint8_t com, uint8_t seg) {
-    slcd_clear_segment(com, seg);
+void watch_clear_pixel(uint8_t com, uint8_t seg) {
+    if (com >= WATCH_DISPLAY_FRAME_COMS || seg >= 32) return;
+    _draw_target->com[com] &= ~((uint32_t)1 << seg);
+}
+
+void watch_update_pixels(uint8_t com, uint32_t clear_mask, uint32_t set_mask) {
+    if (com >= WATCH_DISPLAY_FRAME_COMS) return;
+    _draw_target->com[com] = (_draw_target->com[com] & ~clear_mask) | set_mask;
 }
 
 void watch_clear_display(void) {
-    slcd_clear();
+    memset(_draw_target, 0, sizeof(watch_display_frame_t));
 }
 
-void watch_start_character_blink(char character, uint32_t duration) {
-    slcd_set_frame_counter_enabled(0, false);
+static inline uint32_t _watch_slcd_visible_word(uint8_t com) {
+    uint32_t segments = _fc2_segments.com[com];
+
+    if (_fc2_frames != NULL) return (_committed.com[com] & ~segments) | (_fc2_frames[_fc2_step].com[com] & segments);
+    if (_fc2_step & 1) return _committed.com[com] & ~segments;
+    return _committed.com[com];
+}
+
+void watch_display_commit(void) {
+    // the blink interrupt writes these registers too; keep it out until the words and _committed agree again.
+    if (_fc2_running) NVIC_DisableIRQ(SLCD_IRQn);
+    for (uint8_t com = 0; com < WATCH_DISPLAY_FRAME_COMS; com++) {
+        if (_shadow.com[com] == _committed.com[com]) continue;
+        _committed.com[com] = _shadow.com[com];
+        *_watch_slcd_sdatal(com) = _watch_slcd_visible_word(com);
+    }
+    if (_fc2_running) NVIC_EnableIRQ(SLCD_IRQn);
+}
 
+void watch_display_capture_frame(watch_display_frame_t *frame) {
+    *frame = _shadow;
+}
+
+void watch_display_show_frame(const watch_display_frame_t *frame) {
+    _shadow = *frame;
+}
+
+void watch_display_draw_into_frame(watch_display_frame_t *frame) {
+    _draw_target = frame ? frame : &_shadow;
+}
+
+// frame counters overflow every duration ms; past what 32 frames can time, the prescaler divides the frames by 8.
+static void _watch_slcd_configure_frame_counter(uint8_t fc, uint32_t duration) {
     if (duration <= _slcd_fc_min_ms_bypass) {
-        slcd_configure_frame_counter(0, (duration / (1000 / _slcd_framerate)) - 1, false);
+        slcd_configure_frame_counter(fc, (duration / (1000 / _slcd_framerate)) - 1, false);
     } else {
-        slcd_configure_frame_counter(0, ((duration / (1000 / _slcd_framerate)) / 8 - 1), true);
+        slcd_configure_frame_counter(fc, ((duration / (1000 / _slcd_framerate)) / 8 - 1), true);
     }
+}
+
+void watch_start_character_blink(char character, uint32_t duration) {
+    slcd_set_frame_counter_enabled(0, false);
+
+    _watch_slcd_configure_frame_counter(0, duration);
     slcd_set_frame_counter_enabled(0, true);
 
     watch_display_character(character, 7);
     watch_clear_pixel(2, 10); // clear segment B of position 7 since it can't blink
+    // the SLCD blinks whatever is in its segment data registers, so they need to be current before it starts.
+    watch_display_commit();
 
     slcd_disable();
     slcd_set_blink_enabled(false);
@@ -313,12 +381,9 @@ void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32
             return;
         }
         watch_set_indicator(indicator);
+        watch_display_commit();
 
-        if (duration <= _slcd_fc_min_ms_bypass) {
-            slcd_configure_frame_counter(0, (duration / (1000 / _slcd_framerate)) - 1, false);
-        } else {
-            slcd_configure_frame_counter(0, ((duration / (1000 / _slcd_framerate)) / 8 - 1), true);
-        }
+        _watch_slcd_configure_frame_counter(0, duration);
         slcd_set_frame_counter_enabled(0, true);
 
 
@@ -330,9 +395,96 @@ void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32
     }
 }
 
+static void _watch_slcd_stop_fc2_interrupt(void) {
+    slcd_set_frame_counter_enabled(2, false);
+    SLCD->INTENCLR.reg = SLCD_INTENCLR_FC2O;
+    SLCD->INTFLAG.reg = SLCD_INTFLAG_FC2O;
+    NVIC_DisableIRQ(SLCD_IRQn);
+    _fc2_running = false;
+}
+
+static void _watch_slcd_stop_fc2(void) {
+    _watch_slcd_stop_fc2_interrupt();
+
+    // give the segments back to whatever was drawn in them.
+    watch_display_frame_t segments = _fc2_segments;
+    memset(&_fc2_segments, 0, sizeof(_fc2_segments));
+    _fc2_frames = NULL;
+    _fc2_num_frames = 0;
+    _fc2_step = 0;
+    for (uint8_t com = 0; com < WATCH_DISPLAY_FRAME_COMS; com++) {
+        if (segments.com[com]) *_watch_slcd_sdatal(com) = _committed.com[com];
+    }
+}
+
+static void _watch_slcd_start_fc2(const watch_display_frame_t *segments, const watch_display_frame_t *frames, uint8_t num_frames, bool loop, uint32_t duration) {
+    _watch_slcd_stop_fc2();
+
+    // BCFG can only blink SEG0 and SEG1, and the circular shift register only drives the segments it's wired to, so
+    // anything else is done by hand: frame counter 2 interrupts at each step, and the handler rewrites the registers
+    // those segments are in. That's a few register writes, not a pass through the face.
+    _fc2_segments = *segments;
+    _fc2_frames = frames;
+    _fc2_num_frames = num_frames;
+    _fc2_loop = loop;
+    for (uint8_t com = 0; com < WATCH_DISPLAY_FRAME_COMS; com++) {
+        if (_fc2_segments.com[com]) *_watch_slcd_sdatal(com) = _watch_slcd_visible_word(com);
+    }
+    watch_display_commit();
+    if (frames != NULL && num_frames < 2) return;
+
+    _watch_slcd_configure_frame_counter(2, duration);
+    /// FIXME: #SecondMovement, we need a gossamer wrapper for interrupts.
+    SLCD->INTFLAG.reg = SLCD_INTFLAG_FC2O;
+    SLCD->INTENSET.reg = SLCD_INTENSET_FC2O;
+    NVIC_ClearPendingIRQ(SLCD_IRQn);
+    NVIC_EnableIRQ(SLCD_IRQn);
+    _fc2_running = true;
+    slcd_set_frame_counter_enabled(2, true);
+}
+
+void irq_handler_slcd(void);
+void irq_handler_slcd(void) {
+    SLCD->INTFLAG.reg = SLCD_INTFLAG_FC2O;
+
+    if (_fc2_frames == NULL) {
+        _fc2_step ^= 1;
+    } else if (_fc2_step + 1 < _fc2_num_frames) {
+        _fc2_step++;
+    } else if (_fc2_loop) {
+        _fc2_step = 0;
+    } else {
+        // a one-shot animation holds its last frame until it's stopped.
+        _watch_slcd_stop_fc2_interrupt();
+        return;
+    }
+
+    for (uint8_t com = 0; com < WATCH_DISPLAY_FRAME_COMS; com++) {
+        if (_fc2_segments.com[com]) *_watch_slcd_sdatal(com) = _watch_slcd_visible_word(com);
+    }
+}
+
+void watch_start_segment_blink(const watch_display_frame_t *segments, uint32_t duration) {
+    _watch_slcd_start_fc2(segments, NULL, 0, true, duration);
+}
+
 void watch_stop_blink(void) {
     slcd_set_frame_counter_enabled(0, false);
     slcd_set_blink_enabled(false);
+    if (_fc2_frames == NULL) _watch_slcd_stop_fc2();
+}
+
+void watch_start_segment_animation(const watch_display_frame_t *segments, const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration, bool loop) {
+    if (num_frames == 0) return;
+    _watch_slcd_start_fc2(segments, frames, num_frames, loop, duration);
+}
+
+bool watch_segment_animation_is_running(void) {
+    return _fc2_frames != NULL && _fc2_running;
+}
+
+void watch_stop_segment_animation(void) {
+    if (_fc2_frames != NULL) _watch_slcd_stop_fc2();
 }
 
 void watch_start_sleep_animation(uint32_t duration) {
@@ -343,16 +495,13 @@ void watch_start_sleep_animation(uint32_t duration) {
         // on classic LCD we do the "tick/tock" animation
         watch_display_character(' ', 8);
         watch_display_character(' ', 9);
+        watch_display_commit();
 
         slcd_disable();
         slcd_set_frame_counter_enabled(1, false);
         slcd_set_circular_shift_animation_enabled(false);
 
-        if (duration <= _slcd_fc_min_ms_bypass) {
-            slcd_configure_frame_counter(1, (duration / (1000 / _slcd_framerate)) - 1, false);
-        } else {
-            slcd_configure_frame_counter(1, ((duration / (1000 / _slcd_framerate)) / 8 - 1), true);
-        }
+        _watch_slcd_configure_frame_counter(1, duration);
         slcd_set_frame_counter_enabled(1, true);
 
         slcd_configure_circular_shift_animation(0b00000001, 1, SLCD_CSRSHIFT_LEFT, 1);
@@ -364,8 +513,8 @@ void watch_start_sleep_animation(uint32_t duration) {
 bool watch_sleep_animation_is_running(void) {
     // TODO: wrap this in gossamer call
     if (_installed_display == WATCH_LCD_TYPE_CUSTOM) {
-        // COM3, SEG0 contains the half moon icon
-        return SLCD->SDATAL3.bit.SDATA & 1;
+        // COM3, SEG0 contains the half moon icon; check the frame being drawn, so a face drawing ahead sees its own.
+        return _draw_target->com[3] & 1;
     } else {
         // CSREN indicates that the tick/tick animation is running
         return SLCD->CTRLD.bit.CSREN;
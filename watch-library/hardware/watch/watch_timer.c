@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_timer.h"
+#include "tc.h"
+
+// TC0 runs the buzzer sequencer, fast_stopwatch_face drives TC1 directly, and TC2 is set aside for counting
+// accelerometer interrupts, so the timer lives on TC3. All of them count the 1024 Hz GCLK3.
+
+static bool _timer_enabled = false;
+static watch_cb_t _compare_callback = NULL;
+
+void watch_timer_enable(void) {
+    if (_timer_enabled) return;
+
+    tc_init(3, GENERIC_CLOCK_3, TC_PRESCALER_DIV1);
+    tc_set_counter_mode(3, TC_COUNTER_MODE_16BIT);
+    tc_set_run_in_standby(3, true);
+    /// FIXME: #SecondMovement, we need a gossamer wrapper for interrupts.
+    TC3->COUNT16.INTENCLR.reg = TC_INTENCLR_MC0;
+    TC3->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
+    NVIC_ClearPendingIRQ(TC3_IRQn);
+    NVIC_EnableIRQ(TC3_IRQn);
+    tc_enable(3);
+    _timer_enabled = true;
+}
+
+void watch_timer_disable(void) {
+    if (!_timer_enabled) return;
+
+    watch_timer_disable_compare_callback();
+    tc_disable(3);
+    _timer_enabled = false;
+}
+
+bool watch_timer_is_enabled(void) {
+    return _timer_enabled;
+}
+
+uint16_t watch_timer_get_count(void) {
+    if (!_timer_enabled) return 0;
+
+    // COUNT has to be synchronized from the counter's clock domain before we can read it.
+    TC3->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_READSYNC;
+    while (TC3->COUNT16.SYNCBUSY.bit.CTRLB);
+    while (TC3->COUNT16.CTRLBSET.bit.CMD);
+
+    return TC3->COUNT16.COUNT.reg;
+}
+
+void watch_timer_register_compare_callback(watch_cb_t callback, uint16_t count) {
+    if (!_timer_enabled) return;
+
+    _compare_callback = callback;
+    TC3->COUNT16.CC[0].reg = count;
+    while (TC3->COUNT16.SYNCBUSY.bit.CC0);
+    TC3->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
+    TC3->COUNT16.INTENSET.reg = TC_INTENSET_MC0;
+}
+
+void watch_timer_disable_compare_callback(void) {
+    // with the counter off, TC3 may not even be clocked, and there's no callback to cancel.
+    if (!_timer_enabled) return;
+
+    TC3->COUNT16.INTENCLR.reg = TC_INTENCLR_MC0;
+    TC3->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
+    _compare_callback = NULL;
+}
+
+void irq_handler_tc3(void) {
+    watch_cb_t callback = _compare_callback;
+
+    // one shot: disarm before calling back, so the callback is free to arm the next deadline.
+    watch_timer_disable_compare_callback();
+    if (callback != NULL) callback();
+}
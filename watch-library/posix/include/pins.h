@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+// Stands in for gossamer's board pin definitions in the POSIX build. Each pin is a bit of simulated state: faces and
+// Movement read and write levels through the usual HAL_GPIO_* functions, and the POSIX backend's scripted inputs set
+// the button levels before firing their interrupts.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPIO_PORTA 0
+#define GPIO_PORTB 1
+#define GPIO(port, pin) (((port) << 5) | (pin))
+
+#define HAL_GPIO_PMUX_EIC 0
+#define HAL_GPIO_PMUX_ADC 1
+#define HAL_GPIO_PMUX_SERCOM 2
+#define HAL_GPIO_PMUX_SERCOM_ALT 3
+#define HAL_GPIO_PMUX_TCC_ALT 5
+#define HAL_GPIO_PMUX_RTC 6
+
+#define POSIX_NUM_PINS 32
+
+extern bool _posix_pin_levels[POSIX_NUM_PINS];
+
+#define POSIX_GPIO_PIN(name, number) \
+static inline uint8_t HAL_GPIO_##name##_pin(void) { return number; } \
+static inline void HAL_GPIO_##name##_in(void) {} \
+static inline void HAL_GPIO_##name##_out(void) {} \
+static inline void HAL_GPIO_##name##_off(void) {} \
+static inline void HAL_GPIO_##name##_pullup(void) {} \
+static inline void HAL_GPIO_##name##_pulldown(void) {} \
+static inline void HAL_GPIO_##name##_pmuxen(uint8_t mux) { (void) mux; } \
+static inline void HAL_GPIO_##name##_pmuxdis(void) {} \
+static inline void HAL_GPIO_##name##_set(void) { _posix_pin_levels[number] = true; } \
+static inline void HAL_GPIO_##name##_clr(void) { _posix_pin_levels[number] = false; } \
+static inline void HAL_GPIO_##name##_toggle(void) { _posix_pin_levels[number] = !_posix_pin_levels[number]; } \
+static inline void HAL_GPIO_##name##_write(bool level) { _posix_pin_levels[number] = level; } \
+static inline bool HAL_GPIO_##name##_read(void) { return _posix_pin_levels[number]; }
+
+POSIX_GPIO_PIN(A0, 0)
+POSIX_GPIO_PIN(A1, 1)
+POSIX_GPIO_PIN(A2, 2)
+POSIX_GPIO_PIN(A3, 3)
+POSIX_GPIO_PIN(A4, 4)
+POSIX_GPIO_PIN(BTN_ALARM, 5)
+POSIX_GPIO_PIN(BTN_LIGHT, 6)
+POSIX_GPIO_PIN(BTN_MODE, 7)
+POSIX_GPIO_PIN(BUZZER, 8)
+POSIX_GPIO_PIN(RED, 9)
+POSIX_GPIO_PIN(GREEN, 10)
+POSIX_GPIO_PIN(BLUE, 11)
+POSIX_GPIO_PIN(TEMPSENSE, 12)
+POSIX_GPIO_PIN(TS_ENABLE, 13)
+POSIX_GPIO_PIN(IRSENSE, 14)
+POSIX_GPIO_PIN(IR_ENABLE, 15)
+POSIX_GPIO_PIN(VBUS_DET, 16)
+POSIX_GPIO_PIN(SDA, 17)
+POSIX_GPIO_PIN(SCL, 18)
+POSIX_GPIO_PIN(PIN, 19)
+
+// the simulated board has no accelerometer or IR sensor, and the ADC reads mid-scale, so no thermistor is detected either.
+#define WATCH_RED_TCC_CHANNEL 0
+#define WATCH_GREEN_TCC_CHANNEL 1
+#define WATCH_BLUE_TCC_CHANNEL 2
@@ -0,0 +1,41 @@
+# Build rules for the native POSIX backend, included by the top-level Makefile in place of gossamer's rules.mk.
+#
+#   make posix DISPLAY=classic      builds build-posix/movement
+#   make posix-clean                removes it
+#   make posix-face-sizes           prints what each configured face adds to it
+#
+# See watch-library/posix/watch/watch_posix.c for how to run it.
+
+POSIX_BUILD = build-posix
+POSIX_CC ?= cc
+
+POSIX_CFLAGS = -std=gnu17 -O2 -g -Wall -Wno-unused-parameter
+POSIX_CFLAGS += -D_DEFAULT_SOURCE -DWATCH_POSIX=1 $(DEFINES)
+# gossamer's make rules normally provide this one; the settings face shows it.
+POSIX_CFLAGS += -DBUILD_GIT_HASH=\"$(shell git rev-parse --short=6 HEAD 2>/dev/null || echo posix)\"
+# the tinyusb include path only matters to the firmware build.
+POSIX_INCLUDES = $(filter-out -I./tinyusb/src,$(INCLUDES))
+
+# dummy.c stubs out newlib syscalls the host C library already has. fast_stopwatch_face and peek_memory_face program
+# TC and RTC registers directly, so they can't run off the watch.
+POSIX_SRCS = $(filter-out ./dummy.c ./watch-faces/complication/fast_stopwatch_face.c ./watch-faces/demo/peek_memory_face.c,$(SRCS))
+POSIX_OBJS = $(patsubst ./%.c,$(POSIX_BUILD)/%.o,$(POSIX_SRCS))
+
+posix: $(POSIX_BUILD)/movement
+
+$(POSIX_BUILD)/movement: $(POSIX_OBJS)
+	$(POSIX_CC) -o $@ $^ -lm
+
+$(POSIX_BUILD)/%.o: ./%.c
+	@mkdir -p $(dir $@)
+	$(POSIX_CC) $(POSIX_CFLAGS) $(POSIX_INCLUDES) -MMD -MP -c -o $@ $<
+
+posix-clean:
+	rm -rf $(POSIX_BUILD)
+
+posix-face-sizes: $(POSIX_BUILD)/movement
+	@$(FACE_REGISTRY) sizes --size size --objdir $(POSIX_BUILD) movement_config.h $(filter $(POSIX_SRCS),$(ALL_FACE_SRCS))
+
+-include $(POSIX_OBJS:.o=.d)
+
+.PHONY: posix posix-clean posix-face-sizes
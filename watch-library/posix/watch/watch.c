@@ -0,0 +1,20 @@
+#include "watch.h"
+
+bool watch_is_buzzer_or_led_enabled(void) {
+    return false;
+}
+
+bool watch_is_usb_enabled(void) {
+    return false;
+}
+
+void watch_reset_to_bootloader(void) {
+    // No bootloader in the POSIX build; nothing to do here
+}
+
+void watch_enter_critical_section(void) {
+    // interrupts are only modeled while we're asleep, so they can't land in the middle of anything.
+}
+
+void watch_exit_critical_section(void) {
+}
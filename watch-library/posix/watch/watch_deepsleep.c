@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <stddef.h>
+#include "watch_extint.h"
+#include "watch_posix.h"
+#include "app.h"
+
+static uint32_t watch_backup_data[8];
+
+static watch_cb_t _callback = NULL;
+
+static void cb_extwake_wrapper(void) {
+    if (_callback) {
+        _callback();
+    }
+}
+
+void watch_register_extwake_callback(uint8_t pin, watch_cb_t callback, bool level) {
+    if (pin == HAL_GPIO_BTN_ALARM_pin()) {
+        _callback = callback;
+        watch_enable_external_interrupts();
+        watch_register_interrupt_callback(pin, cb_extwake_wrapper, level ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING);
+    }
+}
+
+void watch_disable_extwake_interrupt(uint8_t pin) {
+    if (pin == HAL_GPIO_BTN_ALARM_pin()) {
+        _callback = NULL;
+        watch_register_interrupt_callback(pin, NULL, INTERRUPT_TRIGGER_NONE);
+    }
+}
+
+void watch_store_backup_data(uint32_t data, uint8_t reg) {
+    if (reg < 8) {
+        watch_backup_data[reg] = data;
+    }
+}
+
+uint32_t watch_get_backup_data(uint8_t reg) {
+    if (reg < 8) {
+        return watch_backup_data[reg];
+    }
+
+    return 0;
+}
+
+void watch_enter_sleep_mode(void) {
+    _posix_set_low_energy(true);
+
+    // disable tick interrupt
+    watch_rtc_disable_all_periodic_callbacks();
+
+    // disable all buttons but alarm
+    watch_register_interrupt_callback(HAL_GPIO_BTN_MODE_pin(), NULL, INTERRUPT_TRIGGER_NONE);
+    watch_register_interrupt_callback(HAL_GPIO_BTN_LIGHT_pin(), NULL, INTERRUPT_TRIGGER_NONE);
+
+    sleep(4);
+
+    _posix_set_low_energy(false);
+
+    // call app_setup so the app can re-enable everything we disabled.
+    app_setup();
+}
+
+void watch_enter_backup_mode(void) {
+    _posix_log("backup");
+
+    // nothing but a reset gets us out of backup mode, and there are no more inputs that could cause one.
+    // run out the clock; the main loop's end of run will end the process.
+    watch_rtc_disable_all_periodic_callbacks();
+    watch_rtc_disable_alarm_callback();
+    while (true) _posix_run_until_interrupt();
+}
+
+void sleep(const uint8_t mode) {
+    (void) mode;
+
+    // the RTC alarm and whichever pins still have interrupts registered will wake us up.
+    _posix_run_until_interrupt();
+}
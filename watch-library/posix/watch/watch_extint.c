@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_extint.h"
+#include "watch_posix.h"
+
+static bool external_interrupt_enabled = false;
+static watch_cb_t _callbacks[POSIX_NUM_PINS];
+static eic_interrupt_trigger_t _triggers[POSIX_NUM_PINS];
+
+void watch_enable_external_interrupts(void) {
+    external_interrupt_enabled = true;
+}
+
+void watch_disable_external_interrupts(void) {
+    external_interrupt_enabled = false;
+}
+
+void watch_register_interrupt_callback(const uint8_t pin, watch_cb_t callback, eic_interrupt_trigger_t trigger) {
+    if (pin >= POSIX_NUM_PINS) return;
+
+    _callbacks[pin] = callback;
+    _triggers[pin] = trigger;
+}
+
+void _posix_extint_set_pin_level(uint8_t pin, bool level) {
+    if (pin >= POSIX_NUM_PINS || _posix_pin_levels[pin] == level) return;
+
+    _posix_pin_levels[pin] = level;
+    _posix_log("pin %u %s", pin, level ? "high" : "low");
+
+    eic_interrupt_trigger_t edge = level ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING;
+    if (external_interrupt_enabled && _callbacks[pin] && (_triggers[pin] & edge) != 0) {
+        static char source[8];
+
+        _callbacks[pin]();
+        snprintf(source, sizeof(source), "pin %u", pin);
+        _posix_interrupt_fired(source);
+    }
+}
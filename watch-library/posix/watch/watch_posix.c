@@ -0,0 +1,355 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Entry point and virtual clock for the POSIX backend. Usage:
+//
+//     movement [-t seconds] [-d unix_time] [-s script] [-n nvm_image] [-l log] [-v] [-w] [-r]
+//
+//   -t  how much virtual time to run for (default 60 seconds; a week is 604800)
+//   -d  the time to set the RTC to at launch, as a UNIX timestamp (default 2025-01-01 00:00:00 UTC)
+//   -s  a script of inputs (see below)
+//   -n  a file that backs the NVM storage area; it is read at launch and written back on sync and at exit
+//   -l  where to write the event log (default stdout)
+//   -v  also log every change to the display's segment buffer
+//   -w  also log every wake from standby, and what caused it
+//   -r  print a power report at the end of the run; see watch_posix_report.c
+//
+// Buzzer notes, LED changes, scripted inputs and low energy mode transitions are always logged.
+//
+// A script is a text file with one input per line: a time in seconds since launch, an input, and a value.
+// - Pins are mode, light, alarm, a2 or a4. Their value is down, up, or press (down, then up an eighth of a second
+//   later) for a digital input, or a number from 0 to 65535 that sets what the ADC reads on that pin.
+// - vcc sets the supply voltage, in millivolts.
+// Blank lines and lines starting with # are ignored. For example:
+//
+//     # long-press mode to go to the secondary face, then come back
+//     2.0  mode  down
+//     3.0  mode  up
+//     5.0  mode  press
+//     # a day later, the battery is running low
+//     86400  vcc  2300
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "watch_posix.h"
+#include "app.h"
+#include "usb.h"
+#include "delay.h"
+
+typedef enum {
+    POSIX_INPUT_DIGITAL = 0,
+    POSIX_INPUT_ANALOG,
+    POSIX_INPUT_VCC,
+} posix_input_type_t;
+
+typedef struct {
+    uint64_t ticks;
+    size_t line_order;
+    posix_input_type_t type;
+    uint8_t pin;
+    uint16_t value;
+} posix_scripted_input_t;
+
+bool _posix_pin_levels[POSIX_NUM_PINS];
+
+static uint64_t _ticks = 0;
+static uint64_t _end_ticks = 60 * POSIX_TICKS_PER_SECOND;
+static bool _asleep = false;
+static bool _low_energy = false;
+static const char *_interrupt_source = NULL;
+static bool _log_display = false;
+static bool _log_wakes = false;
+static bool _print_report = false;
+static FILE *_log_file = NULL;
+
+static posix_scripted_input_t *_script = NULL;
+static size_t _script_length = 0;
+static size_t _script_position = 0;
+
+uint64_t _posix_get_ticks(void) {
+    return _ticks;
+}
+
+void _posix_interrupt_fired(const char *source) {
+    // the first interrupt is the one that woke us up.
+    if (_interrupt_source == NULL) _interrupt_source = source;
+}
+
+void _posix_set_low_energy(bool low_energy) {
+    _low_energy = low_energy;
+    _posix_log(low_energy ? "sleep" : "wake");
+}
+
+void _posix_log(const char *format, ...) {
+    va_list args;
+
+    fprintf(_log_file, "%6llu.%03llu ", (unsigned long long)(_ticks / POSIX_TICKS_PER_SECOND),
+            (unsigned long long)((_ticks % POSIX_TICKS_PER_SECOND) * 1000 / POSIX_TICKS_PER_SECOND));
+    va_start(args, format);
+    vfprintf(_log_file, format, args);
+    va_end(args);
+    fputc('\n', _log_file);
+}
+
+void _posix_display_changed(void) {
+    const uint32_t *segments = _posix_slcd_get_segments();
+
+    _posix_report_frame();
+    if (!_log_display) return;
+
+    char line[POSIX_SLCD_NUM_COMS * 9 + 1];
+    for (uint8_t com = 0; com < POSIX_SLCD_NUM_COMS; com++) {
+        snprintf(line + com * 9, 10, " %08x", segments[com]);
+    }
+    _posix_log("lcd%s", line);
+}
+
+static void _posix_finish(void) {
+    _posix_log("end");
+    if (_print_report) _posix_report_print(_log_file, _ticks);
+    _posix_storage_close();
+    fflush(_log_file);
+    exit(0);
+}
+
+static void _posix_apply_input(const posix_scripted_input_t *input) {
+    switch (input->type) {
+        case POSIX_INPUT_DIGITAL:
+            _posix_extint_set_pin_level(input->pin, input->value != 0);
+            break;
+        case POSIX_INPUT_ANALOG:
+            _posix_log("pin %u analog %u", input->pin, input->value);
+            _posix_adc_set_pin_level(input->pin, input->value);
+            break;
+        case POSIX_INPUT_VCC:
+            _posix_log("vcc %u mV", input->value);
+            _posix_adc_set_vcc_voltage(input->value);
+            break;
+    }
+}
+
+static void _posix_advance_one_tick(void) {
+    // account for the tick that's ending, in whatever state it was spent.
+    _posix_report_tick(!_asleep, _low_energy, _posix_buzzer_is_on(), _posix_led_is_on());
+    _ticks++;
+
+    while (_script_position < _script_length && _script[_script_position].ticks <= _ticks) {
+        _posix_apply_input(&_script[_script_position++]);
+    }
+
+    _posix_rtc_tick(_ticks);
+    _posix_timer_tick(_ticks);
+    _posix_buzzer_tick(_ticks);
+
+    if (_ticks >= _end_ticks) _posix_finish();
+}
+
+void _posix_advance_ticks(uint64_t ticks) {
+    while (ticks--) _posix_advance_one_tick();
+}
+
+void _posix_run_until_interrupt(void) {
+    _interrupt_source = NULL;
+    _asleep = true;
+    while (_interrupt_source == NULL) _posix_advance_one_tick();
+    _asleep = false;
+
+    _posix_report_wake(_interrupt_source);
+    if (_log_wakes) _posix_log("woken by %s", _interrupt_source);
+}
+
+void delay_ms(const uint16_t ms) {
+    // round up, so that a short delay still lets time pass.
+    _posix_advance_ticks(((uint64_t)ms * POSIX_TICKS_PER_SECOND + 999) / 1000);
+}
+
+void delay_us(const uint32_t us) {
+    // anything shorter than a tick is over before the clock can notice.
+    _posix_advance_ticks((uint64_t)us * POSIX_TICKS_PER_SECOND / 1000000);
+}
+
+bool usb_is_enabled(void) {
+    return false;
+}
+
+static int _posix_compare_inputs(const void *a, const void *b) {
+    const posix_scripted_input_t *input_a = a;
+    const posix_scripted_input_t *input_b = b;
+
+    if (input_a->ticks < input_b->ticks) return -1;
+    if (input_a->ticks > input_b->ticks) return 1;
+    // keep the order from the file for inputs that land on the same tick.
+    return (input_a->line_order < input_b->line_order) ? -1 : (input_a->line_order > input_b->line_order);
+}
+
+static bool _posix_add_input(uint64_t ticks, posix_input_type_t type, uint8_t pin, uint16_t value, size_t *capacity) {
+    if (_script_length == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 16;
+        posix_scripted_input_t *script = realloc(_script, *capacity * sizeof(posix_scripted_input_t));
+        if (script == NULL) return false;
+        _script = script;
+    }
+    _script[_script_length] = (posix_scripted_input_t) { ticks, _script_length, type, pin, value };
+    _script_length++;
+
+    return true;
+}
+
+static bool _posix_parse_value(const char *string, uint16_t *value) {
+    char *end;
+    unsigned long parsed = strtoul(string, &end, 10);
+
+    if (*string == '\0' || *end != '\0' || parsed > UINT16_MAX) return false;
+    *value = parsed;
+
+    return true;
+}
+
+static bool _posix_load_script(const char *path) {
+    FILE *file = fopen(path, "r");
+    char line[128];
+    size_t capacity = 0;
+    unsigned line_number = 0;
+
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+
+    while (fgets(line, sizeof(line), file)) {
+        double seconds;
+        char input_name[16];
+        char action[16];
+        uint16_t value;
+        uint8_t pin = 0;
+
+        line_number++;
+        if (line[strspn(line, " \t\r\n")] == '\0' || line[strspn(line, " \t")] == '#') continue;
+        if (sscanf(line, "%lf %15s %15s", &seconds, input_name, action) != 3 || seconds < 0) goto parse_error;
+
+        uint64_t ticks = (uint64_t)(seconds * POSIX_TICKS_PER_SECOND + 0.5);
+        bool ok;
+        if (strcmp(input_name, "vcc") == 0) {
+            if (!_posix_parse_value(action, &value)) goto parse_error;
+            ok = _posix_add_input(ticks, POSIX_INPUT_VCC, 0, value, &capacity);
+        } else {
+            if (strcmp(input_name, "mode") == 0) pin = HAL_GPIO_BTN_MODE_pin();
+            else if (strcmp(input_name, "light") == 0) pin = HAL_GPIO_BTN_LIGHT_pin();
+            else if (strcmp(input_name, "alarm") == 0) pin = HAL_GPIO_BTN_ALARM_pin();
+            else if (strcmp(input_name, "a2") == 0) pin = HAL_GPIO_A2_pin();
+            else if (strcmp(input_name, "a4") == 0) pin = HAL_GPIO_A4_pin();
+            else goto parse_error;
+
+            if (strcmp(action, "down") == 0) ok = _posix_add_input(ticks, POSIX_INPUT_DIGITAL, pin, true, &capacity);
+            else if (strcmp(action, "up") == 0) ok = _posix_add_input(ticks, POSIX_INPUT_DIGITAL, pin, false, &capacity);
+            else if (strcmp(action, "press") == 0) ok = _posix_add_input(ticks, POSIX_INPUT_DIGITAL, pin, true, &capacity) &&
+                                                        _posix_add_input(ticks + POSIX_TICKS_PER_SECOND / 8, POSIX_INPUT_DIGITAL, pin, false, &capacity);
+            else if (_posix_parse_value(action, &value)) ok = _posix_add_input(ticks, POSIX_INPUT_ANALOG, pin, value, &capacity);
+            else goto parse_error;
+        }
+
+        if (!ok) {
+            fclose(file);
+            return false;
+        }
+        continue;
+
+parse_error:
+        fprintf(stderr, "%s:%u: expected <seconds> <mode|light|alarm|a2|a4> <down|up|press|0-65535>, or <seconds> vcc <millivolts>\n", path, line_number);
+        fclose(file);
+        return false;
+    }
+
+    fclose(file);
+    if (_script_length) qsort(_script, _script_length, sizeof(posix_scripted_input_t), _posix_compare_inputs);
+
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    const char *log_path = NULL;
+    const char *nvm_path = NULL;
+    const char *script_path = NULL;
+    uint32_t launch_time = 1735689600; // 2025-01-01 00:00:00 UTC
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:d:s:n:l:vwr")) != -1) {
+        switch (opt) {
+            case 't':
+                _end_ticks = (uint64_t)(strtod(optarg, NULL) * POSIX_TICKS_PER_SECOND);
+                break;
+            case 'd':
+                launch_time = strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                script_path = optarg;
+                break;
+            case 'n':
+                nvm_path = optarg;
+                break;
+            case 'l':
+                log_path = optarg;
+                break;
+            case 'v':
+                _log_display = true;
+                break;
+            case 'w':
+                _log_wakes = true;
+                break;
+            case 'r':
+                _print_report = true;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-t seconds] [-d unix_time] [-s script] [-n nvm_image] [-l log] [-v] [-w] [-r]\n", argv[0]);
+                return 1;
+        }
+    }
+
+    _log_file = stdout;
+    if (log_path != NULL && (_log_file = fopen(log_path, "w")) == NULL) {
+        perror(log_path);
+        return 1;
+    }
+    if (script_path != NULL && !_posix_load_script(script_path)) return 1;
+
+    _posix_rtc_set_launch_time(launch_time);
+    _posix_storage_open(nvm_path);
+
+    app_init();
+    app_setup();
+
+    while (true) {
+        bool can_sleep = app_loop();
+
+        // asleep, nothing happens until the next interrupt; awake, time passes while the CPU runs.
+        if (can_sleep) _posix_run_until_interrupt();
+        else _posix_advance_ticks(1);
+    }
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+// Internal interface of the POSIX backend. Everything here runs on a virtual clock: time only moves when the main loop
+// decides it should (sleeping until the next interrupt, or one tick at a time while Movement stays awake), so a run is
+// fully deterministic and goes as fast as the host can execute it.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "watch.h"
+
+// the virtual clock runs at the rate of the RTC's fastest periodic interrupt.
+#define POSIX_TICKS_PER_SECOND 128
+
+/// @brief Returns the number of 1/128 second ticks since launch.
+uint64_t _posix_get_ticks(void);
+
+/// @brief Runs the virtual clock forward by the given number of ticks, firing anything that comes due on the way.
+void _posix_advance_ticks(uint64_t ticks);
+
+/// @brief Runs the virtual clock forward until something fires an interrupt (a standby sleep on the watch).
+void _posix_run_until_interrupt(void);
+
+/// @brief Called by anything that models an interrupt, so that _posix_run_until_interrupt knows to return.
+/// @param source A short name for what fired ("rtc", "alarm", "pin 7"...), used when logging and reporting wakes.
+void _posix_interrupt_fired(const char *source);
+
+/// @brief Called on the way into and out of low energy mode (a long sleep that only the RTC alarm and A4 wake from).
+void _posix_set_low_energy(bool low_energy);
+
+/// @brief Appends a line to the event log, stamped with the current virtual time.
+void _posix_log(const char *format, ...) __attribute__ ((format (printf, 1, 2)));
+
+// per-tick hooks into the simulated peripherals
+void _posix_rtc_tick(uint64_t ticks);
+void _posix_buzzer_tick(uint64_t ticks);
+void _posix_timer_tick(uint64_t ticks);
+
+// RTC: the launch time, as a UNIX timestamp (UTC).
+void _posix_rtc_set_launch_time(uint32_t timestamp);
+
+// EXTINT: a scripted input changes a pin's level and fires its interrupt, if one is registered.
+void _posix_extint_set_pin_level(uint8_t pin, bool level);
+
+// SLCD: the in-memory segment buffer, one 32-bit word of segments per COM line.
+#define POSIX_SLCD_NUM_COMS 8
+const uint32_t *_posix_slcd_get_segments(void);
+// called by every commit that changes the segments, including those made in low energy mode, which never returns to
+// the main loop; logs the new frame with -v and counts it in the report.
+void _posix_display_changed(void);
+
+// ADC: what the next reading of an analog pin or of VCC will return.
+void _posix_adc_set_pin_level(uint8_t pin, uint16_t level);
+void _posix_adc_set_vcc_voltage(uint16_t millivolts);
+
+// TCC: whether the buzzer or either LED is currently driven.
+bool _posix_buzzer_is_on(void);
+bool _posix_led_is_on(void);
+
+// Power report, in watch_posix_report.c: each tick is charged to whichever face was on screen when it was spent.
+void _posix_report_tick(bool awake, bool low_energy, bool buzzer_on, bool led_on);
+void _posix_report_wake(const char *source);
+void _posix_report_frame(void);
+void _posix_report_commit(uint32_t pixel_updates, uint32_t words_written);
+void _posix_report_print(FILE *file, uint64_t ticks);
+
+// NVM: the file that backs the storage image; NULL keeps it in memory only.
+void _posix_storage_open(const char *path);
+void _posix_storage_close(void);
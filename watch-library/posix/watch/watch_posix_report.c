@@ -0,0 +1,160 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Power report for the POSIX backend. The watch spends nearly all of its life in standby, so what drains the battery
+// is how often it wakes, how long it stays awake once it does, and how long the buzzer and LEDs are on. Every tick of
+// virtual time is charged to the face that was on screen when it was spent, and at the end of a run (with -r) this
+// prints one line per face that was charged anything, along with totals for the whole run.
+//
+// Virtual time only passes while awake if a face asks Movement to stay awake, or delays; a wake that's handled
+// within one tick costs no awake time, which is why wakes are counted separately. The host CPU column is the time
+// this machine spent in each face's loop, from Movement's own face stats; it's only useful to compare faces.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "watch_posix.h"
+#include "movement.h"
+
+#define POSIX_REPORT_MAX_SOURCES 16
+
+typedef struct {
+    uint64_t wakes;
+    uint64_t awake_ticks;
+    uint64_t buzzer_ticks;
+    uint64_t led_ticks;
+    uint64_t frames;
+} posix_face_report_t;
+
+typedef struct {
+    char name[8];
+    uint64_t wakes;
+} posix_wake_source_t;
+
+static posix_face_report_t *_faces = NULL;
+static size_t _num_faces = 0;
+static posix_wake_source_t _sources[POSIX_REPORT_MAX_SOURCES];
+static size_t _num_sources = 0;
+static uint64_t _awake_ticks = 0;
+static uint64_t _low_energy_ticks = 0;
+static uint64_t _wakes = 0;
+static uint64_t _frames = 0;
+static uint64_t _commits = 0;
+static uint64_t _pixel_updates = 0;
+static uint64_t _words_written = 0;
+
+static posix_face_report_t *_posix_report_current_face(void) {
+    size_t index = movement_get_current_face_index();
+
+    if (index >= _num_faces) {
+        posix_face_report_t *faces = realloc(_faces, (index + 1) * sizeof(posix_face_report_t));
+        if (faces == NULL) return NULL;
+        memset(faces + _num_faces, 0, (index + 1 - _num_faces) * sizeof(posix_face_report_t));
+        _faces = faces;
+        _num_faces = index + 1;
+    }
+
+    return &_faces[index];
+}
+
+void _posix_report_tick(bool awake, bool low_energy, bool buzzer_on, bool led_on) {
+    posix_face_report_t *face = _posix_report_current_face();
+
+    if (low_energy) _low_energy_ticks++;
+    if (awake) _awake_ticks++;
+    if (face == NULL) return;
+    if (awake) face->awake_ticks++;
+    if (buzzer_on) face->buzzer_ticks++;
+    if (led_on) face->led_ticks++;
+}
+
+void _posix_report_wake(const char *source) {
+    posix_face_report_t *face = _posix_report_current_face();
+    size_t i;
+
+    _wakes++;
+    if (face != NULL) face->wakes++;
+
+    // sources are few ("rtc", "alarm", one per pin), so a linear search is plenty.
+    for (i = 0; i < _num_sources; i++) {
+        if (strncmp(_sources[i].name, source, sizeof(_sources[i].name) - 1) == 0) break;
+    }
+    if (i == _num_sources) {
+        if (_num_sources == POSIX_REPORT_MAX_SOURCES) return;
+        snprintf(_sources[i].name, sizeof(_sources[i].name), "%s", source);
+        _num_sources++;
+    }
+    _sources[i].wakes++;
+}
+
+void _posix_report_frame(void) {
+    posix_face_report_t *face = _posix_report_current_face();
+
+    _frames++;
+    if (face != NULL) face->frames++;
+}
+
+void _posix_report_commit(uint32_t pixel_updates, uint32_t words_written) {
+    _commits++;
+    _pixel_updates += pixel_updates;
+    _words_written += words_written;
+}
+
+static double _posix_report_seconds(uint64_t ticks) {
+    return (double)ticks / POSIX_TICKS_PER_SECOND;
+}
+
+static double _posix_report_percent(uint64_t part, uint64_t whole) {
+    return whole ? 100.0 * part / whole : 0;
+}
+
+void _posix_report_print(FILE *file, uint64_t ticks) {
+    double hours = _posix_report_seconds(ticks) / 3600;
+
+    fprintf(file, "\n");
+    fprintf(file, "virtual time   %.1f s (%.2f days)\n", _posix_report_seconds(ticks), hours / 24);
+    fprintf(file, "wakes          %llu (%.1f per hour)\n", (unsigned long long)_wakes, hours > 0 ? _wakes / hours : 0);
+    for (size_t i = 0; i < _num_sources; i++) {
+        fprintf(file, "  %-12s %llu\n", _sources[i].name, (unsigned long long)_sources[i].wakes);
+    }
+    fprintf(file, "awake          %.1f s (%.3f%%)\n", _posix_report_seconds(_awake_ticks), _posix_report_percent(_awake_ticks, ticks));
+    fprintf(file, "low energy     %.1f s (%.1f%%)\n", _posix_report_seconds(_low_energy_ticks), _posix_report_percent(_low_energy_ticks, ticks));
+    fprintf(file, "lcd frames     %llu\n", (unsigned long long)_frames);
+    fprintf(file, "lcd commits    %llu (%.1f register writes drawn, %.2f made, per commit)\n", (unsigned long long)_commits,
+            _commits ? (double)_pixel_updates / _commits : 0, _commits ? (double)_words_written / _commits : 0);
+
+    fprintf(file, "\nface      wakes   wakes/h    awake s   buzzer s      led s   frames  host cpu ms\n");
+    for (size_t i = 0; i < _num_faces; i++) {
+        const posix_face_report_t *face = &_faces[i];
+        const movement_face_stats_t *stats = movement_get_face_stats(i);
+        uint64_t active_us = stats ? stats->active_us : 0;
+
+        if (!face->wakes && !face->awake_ticks && !face->buzzer_ticks && !face->led_ticks && !face->frames && !active_us) continue;
+        fprintf(file, "%4zu %10llu %9.1f %10.1f %10.1f %10.1f %8llu %12.1f\n", i,
+                (unsigned long long)face->wakes, hours > 0 ? face->wakes / hours : 0,
+                _posix_report_seconds(face->awake_ticks), _posix_report_seconds(face->buzzer_ticks),
+                _posix_report_seconds(face->led_ticks), (unsigned long long)face->frames, active_us / 1000.0);
+    }
+}
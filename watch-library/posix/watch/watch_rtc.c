@@ -0,0 +1,175 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_rtc.h"
+#include "watch_utility.h"
+#include "watch_posix.h"
+
+// the RTC is a UNIX timestamp at launch plus the virtual clock's ticks. setting the time moves the launch time.
+static int64_t _launch_time = 0;
+
+static watch_cb_t _periodic_callbacks[8];
+static watch_cb_t _alarm_callback = NULL;
+static rtc_date_time_t _alarm_time;
+static rtc_alarm_match_t _alarm_mask = ALARM_MATCH_DISABLED;
+
+watch_cb_t btn_alarm_callback;
+watch_cb_t a2_callback;
+watch_cb_t a4_callback;
+
+void _posix_rtc_set_launch_time(uint32_t timestamp) {
+    _launch_time = timestamp;
+}
+
+bool _watch_rtc_is_enabled(void) {
+    return true;
+}
+
+void _watch_rtc_init(void) {
+#ifdef BUILD_YEAR
+    watch_rtc_set_date_time(watch_get_init_date_time());
+#endif
+}
+
+void watch_rtc_set_date_time(rtc_date_time_t date_time) {
+    _launch_time = (int64_t)watch_utility_date_time_to_unix_time(date_time, 0) - _posix_get_ticks() / POSIX_TICKS_PER_SECOND;
+}
+
+rtc_date_time_t watch_rtc_get_date_time(void) {
+    return watch_utility_date_time_from_unix_time(_launch_time + _posix_get_ticks() / POSIX_TICKS_PER_SECOND, 0);
+}
+
+rtc_date_time_t watch_get_init_date_time(void) {
+    rtc_date_time_t date_time = {0};
+
+#ifdef BUILD_YEAR
+    date_time.unit.year = BUILD_YEAR;
+#else
+    date_time.unit.year = 5;
+#endif
+#ifdef BUILD_MONTH
+    date_time.unit.month = BUILD_MONTH;
+#else
+    date_time.unit.month = 1;
+#endif
+#ifdef BUILD_DAY
+    date_time.unit.day = BUILD_DAY;
+#else
+    date_time.unit.day = 1;
+#endif
+#ifdef BUILD_HOUR
+    date_time.unit.hour = BUILD_HOUR;
+#endif
+#ifdef BUILD_MINUTE
+    date_time.unit.minute = BUILD_MINUTE;
+#endif
+
+    return date_time;
+}
+
+void watch_rtc_register_tick_callback(watch_cb_t callback) {
+    watch_rtc_register_periodic_callback(callback, 1);
+}
+
+void watch_rtc_disable_tick_callback(void) {
+    watch_rtc_disable_periodic_callback(1);
+}
+
+void watch_rtc_register_periodic_callback(watch_cb_t callback, uint8_t frequency) {
+    // we told them, it has to be a power of 2.
+    if (__builtin_popcount(frequency) != 1) return;
+
+    // same numbering as the hardware's PER0-PER7 interrupts: 128 Hz is 0, 1 Hz is 7.
+    uint8_t per_n = __builtin_clz((frequency & 0xFF) << 24);
+    _periodic_callbacks[per_n] = callback;
+}
+
+void watch_rtc_disable_periodic_callback(uint8_t frequency) {
+    if (__builtin_popcount(frequency) != 1) return;
+    uint8_t per_n = __builtin_clz((frequency & 0xFF) << 24);
+    _periodic_callbacks[per_n] = NULL;
+}
+
+void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
+    for (int i = 0; i < 8; i++) {
+        if (mask & (1 << i)) _periodic_callbacks[i] = NULL;
+    }
+}
+
+void watch_rtc_disable_all_periodic_callbacks(void) {
+    watch_rtc_disable_matching_periodic_callbacks(0xFF);
+}
+
+void watch_rtc_register_alarm_callback(watch_cb_t callback, rtc_date_time_t alarm_time, rtc_alarm_match_t mask) {
+    _alarm_callback = callback;
+    _alarm_time = alarm_time;
+    _alarm_mask = mask;
+}
+
+void watch_rtc_disable_alarm_callback(void) {
+    _alarm_callback = NULL;
+    _alarm_mask = ALARM_MATCH_DISABLED;
+}
+
+void watch_rtc_enable(bool en) {
+    (void) en;
+    // Not simulated
+}
+
+void watch_rtc_freqcorr_write(int16_t value, int16_t sign) {
+    (void) value;
+    (void) sign;
+    // Not simulated
+}
+
+static bool _alarm_matches(rtc_date_time_t now) {
+    switch (_alarm_mask) {
+        case ALARM_MATCH_HHMMSS:
+            if (now.unit.hour != _alarm_time.unit.hour) return false;
+            // fall through
+        case ALARM_MATCH_MMSS:
+            if (now.unit.minute != _alarm_time.unit.minute) return false;
+            // fall through
+        case ALARM_MATCH_SS:
+            return now.unit.second == _alarm_time.unit.second;
+        default:
+            return false;
+    }
+}
+
+void _posix_rtc_tick(uint64_t ticks) {
+    // PERn fires at 128 >> n Hz.
+    for (uint8_t per_n = 0; per_n < 8; per_n++) {
+        if (_periodic_callbacks[per_n] && (ticks & ((1 << per_n) - 1)) == 0) {
+            _periodic_callbacks[per_n]();
+            _posix_interrupt_fired("rtc");
+        }
+    }
+
+    if (ticks % POSIX_TICKS_PER_SECOND == 0 && _alarm_callback && _alarm_matches(watch_rtc_get_date_time())) {
+        _alarm_callback();
+        _posix_interrupt_fired("alarm");
+    }
+}
@@ -0,0 +1,180 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <string.h>
+
+#include "watch_slcd.h"
+#include "watch_common_display.h"
+#include "watch_posix.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Segmented Display
+
+// one word per COM line; bit n is segment n. This is what the SLCD's segment data registers would hold.
+static uint32_t _segments[POSIX_SLCD_NUM_COMS];
+static bool _sleep_animation_running = false;
+// everything draws into _shadow; watch_display_commit copies the words that changed to _segments.
+static watch_display_frame_t _shadow;
+// when a face is drawing ahead of time, pixels go here instead.
+static watch_display_frame_t *_draw_target = &_shadow;
+// updates drawn into _shadow since the last commit; before there was a shadow, each of these was a register write.
+static uint32_t _pixel_updates = 0;
+// the watch plays segment animations on its own; here, one frame of the animation is shown steadily in its segments.
+static watch_display_frame_t _animation_segments;
+static const watch_display_frame_t *_animation_frame = NULL;
+static bool _animation_running = false;
+
+const uint32_t *_posix_slcd_get_segments(void) {
+    return _segments;
+}
+
+watch_lcd_type_t watch_get_lcd_type(void) {
+#if defined(FORCE_CUSTOM_LCD_TYPE)
+    return WATCH_LCD_TYPE_CUSTOM;
+#else
+    return WATCH_LCD_TYPE_CLASSIC;
+#endif
+}
+
+void watch_enable_display(void) {
+    // like the watch, leave the display alone if it's already on; app_setup calls this again after every sleep.
+    static bool enabled = false;
+    if (enabled) return;
+    enabled = true;
+
+    _watch_display_install_driver(watch_get_lcd_type());
+
+    watch_clear_display();
+    watch_display_commit();
+}
+
+void watch_set_pixel(uint8_t com, uint8_t seg) {
+    if (com >= WATCH_DISPLAY_FRAME_COMS || seg >= 32) return;
+    _draw_target->com[com] |= (uint32_t)1 << seg;
+    if (_draw_target == &_shadow) _pixel_updates++;
+}
+
+void watch_clear_pixel(uint8_t com, uint8_t seg) {
+    if (com >= WATCH_DISPLAY_FRAME_COMS || seg >= 32) return;
+    _draw_target->com[com] &= ~((uint32_t)1 << seg);
+    if (_draw_target == &_shadow) _pixel_updates++;
+}
+
+void watch_update_pixels(uint8_t com, uint32_t clear_mask, uint32_t set_mask) {
+    if (com >= WATCH_DISPLAY_FRAME_COMS) return;
+    _draw_target->com[com] = (_draw_target->com[com] & ~clear_mask) | set_mask;
+    if (_draw_target == &_shadow) _pixel_updates++;
+}
+
+void watch_clear_display(void) {
+    memset(_draw_target, 0, sizeof(watch_display_frame_t));
+    if (_draw_target == &_shadow) _pixel_updates += WATCH_DISPLAY_FRAME_COMS;
+}
+
+void watch_display_commit(void) {
+    uint32_t words_written = 0;
+
+    for (uint8_t com = 0; com < WATCH_DISPLAY_FRAME_COMS; com++) {
+        uint32_t visible = _shadow.com[com];
+        if (_animation_frame != NULL) visible = (visible & ~_animation_segments.com[com]) | (_animation_frame->com[com] & _animation_segments.com[com]);
+        if (_segments[com] == visible) continue;
+        _segments[com] = visible;
+        words_written++;
+    }
+    if (_pixel_updates || words_written) _posix_report_commit(_pixel_updates, words_written);
+    _pixel_updates = 0;
+    if (words_written) _posix_display_changed();
+}
+
+void watch_display_capture_frame(watch_display_frame_t *frame) {
+    *frame = _shadow;
+}
+
+void watch_display_show_frame(const watch_display_frame_t *frame) {
+    _shadow = *frame;
+}
+
+void watch_display_draw_into_frame(watch_display_frame_t *frame) {
+    _draw_target = frame ? frame : &_shadow;
+}
+
+// Blinking is done by the SLCD's own hardware on the watch; here the character is simply shown, steadily.
+void watch_start_character_blink(char character, uint32_t duration) {
+    (void) duration;
+    watch_display_character(character, 7);
+    watch_clear_pixel(2, 10); // clear segment B of position 7 since it can't blink
+}
+
+void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32_t duration) {
+    (void) duration;
+    watch_set_indicator(indicator);
+}
+
+void watch_start_segment_blink(const watch_display_frame_t *segments, uint32_t duration) {
+    (void) segments;
+    (void) duration;
+    // on the watch, this takes over the frame counter an animation would be using.
+    watch_stop_segment_animation();
+}
+
+void watch_stop_blink(void) {
+}
+
+// looping animations are shown on their first frame, and one-shot animations on the last, where they end up.
+void watch_start_segment_animation(const watch_display_frame_t *segments, const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration, bool loop) {
+    (void) duration;
+    if (num_frames == 0) return;
+    _animation_segments = *segments;
+    _animation_frame = loop ? &frames[0] : &frames[num_frames - 1];
+    _animation_running = loop && num_frames > 1;
+    watch_display_commit();
+}
+
+bool watch_segment_animation_is_running(void) {
+    return _animation_running;
+}
+
+void watch_stop_segment_animation(void) {
+    if (_animation_frame == NULL) return;
+    _animation_frame = NULL;
+    _animation_running = false;
+    watch_display_commit();
+}
+
+void watch_start_sleep_animation(uint32_t duration) {
+    (void) duration;
+    if (_sleep_animation_running) return;
+    watch_display_character(' ', 8);
+    _sleep_animation_running = true;
+}
+
+bool watch_sleep_animation_is_running(void) {
+    return _sleep_animation_running;
+}
+
+void watch_stop_sleep_animation(void) {
+    _sleep_animation_running = false;
+    watch_display_character(' ', 8);
+}
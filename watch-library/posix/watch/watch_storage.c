@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "watch_storage.h"
+#include "watch_posix.h"
+
+// the RWWEE area the filesystem lives in, kept in memory and written back to a file on sync.
+#define POSIX_STORAGE_SIZE (NVMCTRL_RWWEE_PAGES * NVMCTRL_PAGE_SIZE)
+
+static uint8_t storage[POSIX_STORAGE_SIZE];
+static const char *_image_path = NULL;
+
+void _posix_storage_open(const char *path) {
+    // a fresh image is erased flash.
+    memset(storage, 0xff, sizeof(storage));
+    _image_path = path;
+    if (path == NULL) return;
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return;
+    if (fread(storage, 1, sizeof(storage), file) != sizeof(storage)) {
+        fprintf(stderr, "%s: not a %u byte NVM image; starting from an erased one\n", path, POSIX_STORAGE_SIZE);
+        memset(storage, 0xff, sizeof(storage));
+    }
+    fclose(file);
+}
+
+void _posix_storage_close(void) {
+    watch_storage_sync();
+}
+
+static bool _in_bounds(uint32_t row, uint32_t offset, uint32_t size) {
+    uint64_t end = (uint64_t)row * NVMCTRL_ROW_SIZE + offset + size;
+    return end <= POSIX_STORAGE_SIZE;
+}
+
+bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    if (!_in_bounds(row, offset, size)) return false;
+    memcpy(buffer, storage + row * NVMCTRL_ROW_SIZE + offset, size);
+
+    return true;
+}
+
+bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    if (!_in_bounds(row, offset, size)) return false;
+    // like the flash it stands in for, a write can only clear bits; erase sets them.
+    for (uint32_t i = 0; i < size; i++) storage[row * NVMCTRL_ROW_SIZE + offset + i] &= buffer[i];
+
+    return true;
+}
+
+bool watch_storage_erase(uint32_t row) {
+    if (!_in_bounds(row, 0, NVMCTRL_ROW_SIZE)) return false;
+    memset(storage + row * NVMCTRL_ROW_SIZE, 0xff, NVMCTRL_ROW_SIZE);
+
+    return true;
+}
+
+bool watch_storage_sync(void) {
+    if (_image_path == NULL) return true;
+
+    FILE *file = fopen(_image_path, "wb");
+    if (file == NULL) return false;
+    bool ok = fwrite(storage, 1, sizeof(storage), file) == sizeof(storage);
+
+    return (fclose(file) == 0) && ok;
+}
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_timer.h"
+#include "watch_posix.h"
+
+// The counter is derived from the virtual clock, which moves in steps of 8 counts; the compare callback fires on the
+// tick that carries the counter past its count.
+
+#define POSIX_TIMER_COUNTS_PER_TICK (WATCH_TIMER_TICKS_PER_SECOND / POSIX_TICKS_PER_SECOND)
+
+static bool _timer_enabled = false;
+static uint64_t _enabled_at;
+static watch_cb_t _compare_callback = NULL;
+static uint16_t _compare_count;
+
+void watch_timer_enable(void) {
+    if (_timer_enabled) return;
+
+    _enabled_at = _posix_get_ticks();
+    _timer_enabled = true;
+}
+
+void watch_timer_disable(void) {
+    watch_timer_disable_compare_callback();
+    _timer_enabled = false;
+}
+
+bool watch_timer_is_enabled(void) {
+    return _timer_enabled;
+}
+
+uint16_t watch_timer_get_count(void) {
+    if (!_timer_enabled) return 0;
+
+    return ((_posix_get_ticks() - _enabled_at) * POSIX_TIMER_COUNTS_PER_TICK) & 0xFFFF;
+}
+
+void watch_timer_register_compare_callback(watch_cb_t callback, uint16_t count) {
+    if (!_timer_enabled) return;
+
+    _compare_callback = callback;
+    _compare_count = count;
+}
+
+void watch_timer_disable_compare_callback(void) {
+    _compare_callback = NULL;
+}
+
+void _posix_timer_tick(uint64_t ticks) {
+    (void) ticks;
+    if (!_timer_enabled || _compare_callback == NULL) return;
+    if ((uint16_t)(watch_timer_get_count() - _compare_count) >= POSIX_TIMER_COUNTS_PER_TICK) return;
+
+    watch_cb_t callback = _compare_callback;
+    _compare_callback = NULL;
+    callback();
+    _posix_interrupt_fired("timer");
+}
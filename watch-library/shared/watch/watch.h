@@ -53,6 +53,8 @@
                          the I2C bus, putting values directly on the bus and reading data from registers on I2C devices.
             - @ref spi - This section covers functions related to the SAM L22's built-in SPI driver.
             - @ref uart - This section covers functions related to the UART peripheral.
+            - @ref timer - This section covers functions related to a free-running counter with a one-shot compare
+                           interrupt, for timing things more finely than the RTC can.
             - @ref deepsleep - This section covers functions related to preparing for and entering BACKUP mode, the
                                deepest sleep mode available on the SAM L22.
  */
@@ -71,6 +73,7 @@ typedef void (*watch_cb_t)(void);
 #include "watch_spi.h"
 #include "watch_uart.h"
 #include "watch_storage.h"
+#include "watch_timer.h"
 #include "watch_deepsleep.h"
 
 /** @brief Interrupt handler for the SYSTEM interrupt, which handles MCLK,
@@ -85,6 +88,16 @@ void irq_handler_system(void);
   */
 void watch_reset_to_bootloader(void);
 
+/** @brief Holds off interrupts until the matching call to watch_exit_critical_section, so that code running outside
+ *         of an interrupt can update state that interrupt handlers also change. Calls may be nested.
+ *  @note Keep these short: while interrupts are held off, buttons, ticks and the timer all wait.
+ */
+void watch_enter_critical_section(void);
+
+/** @brief Lets interrupts through again, once the outermost watch_enter_critical_section has been matched.
+ */
+void watch_exit_critical_section(void);
+
 /** @brief Disables the TRNG twice in order to work around silicon erratum 1.16.1.
  *  FIXME: find a better place for this, a couple of watch faces need it.
  */
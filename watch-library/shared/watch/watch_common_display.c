@@ -24,139 +24,118 @@
 
 #include "watch_slcd.h"
 #include "watch_common_display.h"
+#include "watch_glyph_masks.h"
+#include "watch_display_format.h"
 #include <string.h>
-#include <stdio.h>
-#include <stdlib.h>
 #include <math.h>
 
-uint8_t IndicatorSegments[8] = {
-    SLCD_SEGID(0, 17), // WATCH_INDICATOR_SIGNAL
-    SLCD_SEGID(0, 16), // WATCH_INDICATOR_BELL
-    SLCD_SEGID(2, 17), // WATCH_INDICATOR_PM
-    SLCD_SEGID(2, 16), // WATCH_INDICATOR_24H
-    SLCD_SEGID(1, 10), // WATCH_INDICATOR_LAP
-
-    // Placeholders for indicators unavailable on the original F-91W LCD
-    SLCD_SEGID(4, 0),  // WATCH_INDICATOR_ARROWS (does not exist, will set in SDATAL4 which is harmless)
-    SLCD_SEGID(4, 0),  // WATCH_INDICATOR_SLEEP (does not exist, will set in SDATAL4 which is harmless)
-    SLCD_SEGID(4, 0)   // WATCH_INDICATOR_COLON (does not exist, will set in SDATAL4 which is harmless)
+#if !defined(FORCE_CUSTOM_LCD_TYPE)
+const watch_display_driver_t Classic_LCD_Display_Driver = {
+    .type = WATCH_LCD_TYPE_CLASSIC,
+    .num_positions = CLASSIC_LCD_GLYPH_POSITIONS,
+    .num_coms = CLASSIC_LCD_GLYPH_COMS,
+    .glyph_clear = &Classic_LCD_Glyph_Clear[0][0],
+    .glyph_shift = Classic_LCD_Glyph_Shift,
+    .glyph_set = &Classic_LCD_Glyph_Set[0][0][0],
+    .indicator_segments = {
+        SLCD_SEGID(0, 17), // WATCH_INDICATOR_SIGNAL
+        SLCD_SEGID(0, 16), // WATCH_INDICATOR_BELL
+        SLCD_SEGID(2, 17), // WATCH_INDICATOR_PM
+        SLCD_SEGID(2, 16), // WATCH_INDICATOR_24H
+        SLCD_SEGID(1, 10), // WATCH_INDICATOR_LAP
+        // indicators unavailable on the original F-91W LCD
+        WATCH_DISPLAY_NO_SEGMENT, // WATCH_INDICATOR_ARROWS
+        WATCH_DISPLAY_NO_SEGMENT, // WATCH_INDICATOR_SLEEP
+        WATCH_DISPLAY_NO_SEGMENT, // WATCH_INDICATOR_COLON
+    },
+    .colon_segment = SLCD_SEGID(1, 16),
+    .decimal_segment = WATCH_DISPLAY_NO_SEGMENT,
+    .bottom_one_segment = WATCH_DISPLAY_NO_SEGMENT,
+    .long_text = false,
 };
+#endif
+
+#if !defined(FORCE_CLASSIC_LCD_TYPE)
+const watch_display_driver_t Custom_LCD_Display_Driver = {
+    .type = WATCH_LCD_TYPE_CUSTOM,
+    .num_positions = CUSTOM_LCD_GLYPH_POSITIONS,
+    .num_coms = CUSTOM_LCD_GLYPH_COMS,
+    .glyph_clear = &Custom_LCD_Glyph_Clear[0][0],
+    .glyph_shift = Custom_LCD_Glyph_Shift,
+    .glyph_set = &Custom_LCD_Glyph_Set[0][0][0],
+    .indicator_segments = {
+        SLCD_SEGID(0, 21), // WATCH_INDICATOR_SIGNAL
+        SLCD_SEGID(1, 21), // WATCH_INDICATOR_BELL
+        SLCD_SEGID(3, 21), // WATCH_INDICATOR_PM
+        SLCD_SEGID(2, 21), // WATCH_INDICATOR_24H
+        SLCD_SEGID(1,  0), // WATCH_INDICATOR_LAP
+        SLCD_SEGID(2,  0), // WATCH_INDICATOR_ARROWS
+        SLCD_SEGID(3,  0), // WATCH_INDICATOR_SLEEP
+        WATCH_DISPLAY_NO_SEGMENT, // WATCH_INDICATOR_COLON (use watch_set_colon)
+    },
+    .colon_segment = SLCD_SEGID(0, 0),
+    .decimal_segment = SLCD_SEGID(0, 14),
+    .bottom_one_segment = SLCD_SEGID(0, 22),
+    .long_text = true,
+};
+#endif
 
-void watch_display_character(uint8_t character, uint8_t position) {
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        if (character == 'R' && position > 1 && position < 8) character = 'r'; // We can't display uppercase R in these positions
-        else if (character == 'T' && position > 1 && position < 8) character = 't'; // lowercase t is the only option for these positions
-    } else {
-        // special cases for positions 4 and 6
-        if (position == 4 || position == 6) {
-            if (character == '7') character = '&'; // "lowercase" 7
-            else if (character == 'A') character = 'a'; // A needs to be lowercase
-            else if (character == 'o') character = 'O'; // O needs to be uppercase
-            else if (character == 'L') character = '!'; // L needs to be in top half
-            else if (character == 'M' || character == 'm' || character == 'N') character = 'n'; // M and uppercase N need to be lowercase n
-            else if (character == 'c') character = 'C'; // C needs to be uppercase
-            else if (character == 'J') character = 'j'; // same
-            else if (character == 'v' || character == 'V' || character == 'U' || character == 'W' || character == 'w') character = 'u'; // bottom segment duplicated, so show in top half
-            else if (character == 't' || character == 'T') character = '+'; // avoid confusion with uppercase E
-        } else {
-            if (character == 'u') character = 'v'; // we can use the bottom segment; move to lower half
-            else if (character == 'j') character = 'J'; // same but just display a normal J
-            else if (character == '.') character = '_'; // we can use the bottom segment; make dot an underscore
-        }
-        if (position > 1) {
-            if (character == 'T') character = 't'; // uppercase T only works in positions 0 and 1
-        }
-        if (position == 1) {
-            if (character == 'a') character = 'A'; // A needs to be uppercase
-            else if (character == 'o') character = 'O'; // O needs to be uppercase
-            else if (character == 'i') character = 'l'; // I needs to be uppercase (use an l, it looks the same)
-            else if (character == 'n') character = 'N'; // N needs to be uppercase
-            else if (character == 'r') character = 'R'; // R needs to be uppercase
-            else if (character == 'd') character = 'D'; // D needs to be uppercase
-            else if (character == 'v' || character == 'V' || character == 'u') character = 'U'; // side segments shared, make uppercase
-            else if (character == 'b') character = 'B'; // B needs to be uppercase
-            else if (character == 'c') character = 'C'; // C needs to be uppercase
-        } else {
-            if (character == 'R') character = 'r'; // R needs to be lowercase almost everywhere
-        }
-        if (position == 0) {
-            watch_clear_pixel(0, 15); // clear funky ninth segment
-        } else {
-            if (character == 'I') character = 'l'; // uppercase I only works in position 0
-        }
-    }
+// until watch_discover_lcd_type says otherwise, assume the LCD the build is for (or the classic one, if it could be either).
+#if defined(FORCE_CUSTOM_LCD_TYPE)
+static const watch_display_driver_t *_watch_display_driver = &Custom_LCD_Display_Driver;
+#else
+static const watch_display_driver_t *_watch_display_driver = &Classic_LCD_Display_Driver;
+#endif
 
-    digit_mapping_t segmap;
-    uint8_t segdata;
+void watch_display_set_driver(const watch_display_driver_t *driver) {
+    _watch_display_driver = driver;
+}
 
-    /// TODO: This could be optimized by doing this check once and setting a pointer in watch_discover_lcd_type.
+const watch_display_driver_t *watch_display_get_driver(void) {
+    return _watch_display_driver;
+}
 
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        segmap = Custom_LCD_Display_Mapping[position];
-        segdata = Custom_LCD_Character_Set[character - 0x20];
-    } else {
-        segmap = Classic_LCD_Display_Mapping[position];
-        segdata = Classic_LCD_Character_Set[character - 0x20];
+void _watch_display_install_driver(watch_lcd_type_t type) {
+#if !defined(FORCE_CLASSIC_LCD_TYPE)
+    if (type == WATCH_LCD_TYPE_CUSTOM) {
+        watch_display_set_driver(&Custom_LCD_Display_Driver);
+        return;
     }
+#endif
+#if !defined(FORCE_CUSTOM_LCD_TYPE)
+    if (type == WATCH_LCD_TYPE_CLASSIC) watch_display_set_driver(&Classic_LCD_Display_Driver);
+#endif
+}
 
-    for (int i = 0; i < 8; i++) {
-        if (segmap.segment[i].value == segment_does_not_exist) {
-            // Segment does not exist; skip it.
-            segdata = segdata >> 1;
-            continue;
-        }
-        uint8_t com = segmap.segment[i].address.com;
-        uint8_t seg = segmap.segment[i].address.seg;
+static inline void _watch_display_set_segment(uint8_t segid) {
+    if (segid != WATCH_DISPLAY_NO_SEGMENT) watch_set_pixel(SLCD_COMNUM(segid), SLCD_SEGNUM(segid));
+}
 
-        if (segdata & 1) {
-            watch_set_pixel(com, seg);
-        }
-        else {
-            watch_clear_pixel(com, seg);
-        }
+static inline void _watch_display_clear_segment(uint8_t segid) {
+    if (segid != WATCH_DISPLAY_NO_SEGMENT) watch_clear_pixel(SLCD_COMNUM(segid), SLCD_SEGNUM(segid));
+}
 
-        segdata = segdata >> 1;
+void watch_display_character(uint8_t character, uint8_t position) {
+    // The substitutions for characters a position can't show (lowercase r for R in most places, and so on) and the
+    // segments each character needs are all worked out ahead of time, by utils/glyph_masks/glyph_masks.py. That
+    // leaves one masked update per COM line.
+    const watch_display_driver_t *driver = _watch_display_driver;
+
+    if (position >= driver->num_positions) return;
+    if (character < WATCH_GLYPH_FIRST_CHARACTER || character > WATCH_GLYPH_LAST_CHARACTER) character = ' ';
+
+    const uint32_t *clear = driver->glyph_clear + position * driver->num_coms;
+    const uint16_t *set = driver->glyph_set + (position * WATCH_GLYPH_NUM_CHARACTERS + character - WATCH_GLYPH_FIRST_CHARACTER) * driver->num_coms;
+    uint8_t shift = driver->glyph_shift[position];
+    for (uint8_t com = 0; com < driver->num_coms; com++) {
+        watch_update_pixels(com, clear[com], (uint32_t)set[com] << shift);
     }
-
-    if (character == 'T' && position == 1) watch_set_pixel(1, 12); // add descender
-    else if (position == 0 && (character == 'B' || character == 'D' || character == '@')) watch_set_pixel(0, 15); // add funky ninth segment
-    else if (position == 1 && (character == 'B' || character == 'D' || character == '@')) watch_set_pixel(0, 12); // add funky ninth segment
 }
 
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position) {
-    // Will only work for digits and for positions  8 and 9 - but less code & checks to reduce power consumption
-
-    digit_mapping_t segmap;
-    uint8_t segdata;
-
-    /// TODO: See optimization note above.
-
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        segmap = Custom_LCD_Display_Mapping[position];
-        segdata = Custom_LCD_Character_Set[character - 0x20];
-    } else {
-        segmap = Classic_LCD_Display_Mapping[position];
-        segdata = Classic_LCD_Character_Set[character - 0x20];
-    }
-
-    for (int i = 0; i < 8; i++) {
-        if (segmap.segment[i].value == segment_does_not_exist) {
-            // Segment does not exist; skip it.
-            segdata = segdata >> 1;
-            continue;
-        }
-        uint8_t com = segmap.segment[i].address.com;
-        uint8_t seg = segmap.segment[i].address.seg;
-
-        if (segdata & 1) {
-            watch_set_pixel(com, seg);
-        }
-        else {
-            watch_clear_pixel(com, seg);
-        }
-
-        segdata = segdata >> 1;
-    }
+    // This used to skip the substitutions to save time in the seconds positions; with those precomputed, there's
+    // nothing left to skip.
+    watch_display_character(character, position);
 }
 
 void watch_display_string(const char *string, uint8_t position) {
@@ -185,9 +164,7 @@ void watch_display_text(watch_position_t location, const char *string) {
             break;
         case WATCH_POSITION_BOTTOM:
             {
-                if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-                    watch_clear_pixel(0, 22);
-                }
+                _watch_display_clear_segment(_watch_display_driver->bottom_one_segment);
                 int i = 0;
                 while (string[i] != 0) {
                     watch_display_character(string[i], 4 + i);
@@ -219,7 +196,7 @@ void watch_display_text(watch_position_t location, const char *string) {
             #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
             watch_display_string(string, 0);
             #pragma GCC diagnostic pop
-            if (watch_get_lcd_type()  == WATCH_LCD_TYPE_CUSTOM) {
+            if (_watch_display_driver->num_positions > 10) {
                 if (strlen(string) >= 11) watch_display_character(string[10], 10);
                 else watch_display_character(' ', 10);
             }
@@ -227,7 +204,7 @@ void watch_display_text(watch_position_t location, const char *string) {
 }
 
 void watch_display_text_with_fallback(watch_position_t location, const char *string, const char *fallback) {
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
+    if (_watch_display_driver->long_text) {
         switch (location) {
             case WATCH_POSITION_TOP:
                 for (size_t i = 0; i < strlen(string); i++) {
@@ -251,12 +228,12 @@ void watch_display_text_with_fallback(watch_position_t location, const char *str
                 break;
             case WATCH_POSITION_BOTTOM:
             {
-                watch_clear_pixel(0, 22);
+                _watch_display_clear_segment(_watch_display_driver->bottom_one_segment);
                 int i = 0;
                 int offset = 0;
                 size_t len = strlen(string);
                 if (len == 7 && string[0] == '1') {
-                    watch_set_pixel(0, 22);
+                    _watch_display_set_segment(_watch_display_driver->bottom_one_segment);
                     offset = 1;
                     i++;
                 }
@@ -280,6 +257,41 @@ void watch_display_text_with_fallback(watch_position_t location, const char *str
     }
 }
 
+// Multiplies a float by 10 or 100 and rounds it to a whole number, exactly, with integer math alone: the float is
+// mantissa * 2^exponent, and mantissa * scale still fits in 32 bits. round() takes halfway cases away from zero, and
+// printf's %f takes them to the even neighbor; half_to_even picks which one to match.
+static uint32_t _watch_display_scale_float(float value, uint32_t scale, bool half_to_even) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t exponent = (bits >> 23) & 0xff;
+    uint32_t mantissa = bits & 0x7fffff;
+    int32_t shift;
+    if (exponent == 0) {
+        shift = 149;
+    } else {
+        mantissa |= 0x800000;
+        shift = 150 - (int32_t)exponent;
+    }
+    // far too big to display (or not a number); the caller has already ruled these out.
+    if (shift <= 0) return 0;
+    if (shift >= 32) return 0;
+
+    uint32_t scaled = mantissa * scale;
+    uint32_t quotient = scaled >> shift;
+    uint32_t remainder = scaled & ((1u << shift) - 1);
+    uint32_t half = 1u << (shift - 1);
+    if (remainder > half || (remainder == half && (!half_to_even || (quotient & 1)))) quotient++;
+
+    return quotient;
+}
+
+// Puts the units after a number, cutting the whole thing off at seven characters as snprintf into eight bytes did.
+static void _watch_display_append_units(char *buf, char *end, const char *units) {
+    while (*units && end < buf + 7) *end++ = *units++;
+    *end = '\0';
+}
+
 void watch_display_float_with_best_effort(float value, const char *units) {
     char buf[8];
     char buf_fallback[8];
@@ -295,28 +307,36 @@ void watch_display_float_with_best_effort(float value, const char *units) {
         return;
     }
 
-    uint16_t value_times_100 = abs((int)round(value * 100.0));
+    // This used to be snprintf with %f, round() and abs(), all in software floating point. Everything below is
+    // worked out from the float's bits instead, and writes the same characters those did.
+    uint16_t value_times_100 = _watch_display_scale_float(value, 100, false);
     bool set_decimal = true;
+    bool negative = signbit(value);
+    if (units == NULL) units = blank_units;
 
     if (value < 0 && value_times_100 != 0) {
         if (value_times_100 > 999) {
             // decimal point isn't in the right place for these numbers; use same format as classic.
             set_decimal = false;
-            snprintf(buf, sizeof(buf), "-%4.1f%s", -value, units ? units : blank_units);
-            snprintf(buf_fallback, sizeof(buf_fallback), "%s", buf);
+            buf[0] = '-';
+            _watch_display_append_units(buf, _watch_format_fixed_magnitude(buf + 1, _watch_display_scale_float(value, 10, true), false, 1, 4), units);
+            memcpy(buf_fallback, buf, sizeof(buf));
         } else {
-            snprintf(buf, sizeof(buf), "-%03d%s", value_times_100 % 1000u, units ? units : blank_units);
-            snprintf(buf_fallback, sizeof(buf_fallback), "-%3.1f%s", -value, units ? units : blank_units);
+            buf[0] = '-';
+            _watch_display_append_units(buf, watch_format_unsigned(buf + 1, value_times_100 % 1000u, 3, '0'), units);
+            buf_fallback[0] = '-';
+            _watch_display_append_units(buf_fallback, _watch_format_fixed_magnitude(buf_fallback + 1, _watch_display_scale_float(value, 10, true), false, 1, 3), units);
         }
     } else if (value_times_100 > 9999) {
-        snprintf(buf, sizeof(buf), "%5u%s", value_times_100, units ? units : blank_units);
-        snprintf(buf_fallback, sizeof(buf_fallback), "%4.1f%s", value, units ? units : blank_units);
+        _watch_display_append_units(buf, watch_format_unsigned(buf, value_times_100, 5, ' '), units);
+        _watch_display_append_units(buf_fallback, _watch_format_fixed_magnitude(buf_fallback, _watch_display_scale_float(value, 10, true), negative, 1, 4), units);
     } else if (value_times_100 > 999) {
-        snprintf(buf, sizeof(buf), "%4u%s", value_times_100, units ? units : blank_units);
-        snprintf(buf_fallback, sizeof(buf_fallback), "%4.1f%s", value, units ? units : blank_units);
+        _watch_display_append_units(buf, watch_format_unsigned(buf, value_times_100, 4, ' '), units);
+        _watch_display_append_units(buf_fallback, _watch_format_fixed_magnitude(buf_fallback, _watch_display_scale_float(value, 10, true), negative, 1, 4), units);
     } else {
-        snprintf(buf, sizeof(buf), " %03u%s", value_times_100 % 1000u, units ? units : blank_units);
-        snprintf(buf_fallback, sizeof(buf_fallback), "%4.2f%s", value, units ? units : blank_units);
+        buf[0] = ' ';
+        _watch_display_append_units(buf, watch_format_unsigned(buf + 1, value_times_100 % 1000u, 3, '0'), units);
+        _watch_display_append_units(buf_fallback, _watch_format_fixed_magnitude(buf_fallback, _watch_display_scale_float(value, 100, true), negative, 2, 4), units);
     }
 
     watch_display_text_with_fallback(WATCH_POSITION_BOTTOM, buf, buf_fallback);
@@ -328,67 +348,118 @@ void watch_display_float_with_best_effort(float value, const char *units) {
 }
 
 void watch_set_colon(void) {
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        watch_set_pixel(0, 0);
-    } else {
-        watch_set_pixel(1, 16);
-    }
+    _watch_display_set_segment(_watch_display_driver->colon_segment);
 }
 
 void watch_clear_colon(void) {
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        watch_clear_pixel(0, 0);
-    } else {
-        watch_clear_pixel(1, 16);
-    }
+    _watch_display_clear_segment(_watch_display_driver->colon_segment);
 }
 
 void watch_set_decimal_if_available(void) {
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        watch_set_pixel(0, 14);
-    }
+    _watch_display_set_segment(_watch_display_driver->decimal_segment);
 }
 
 void watch_clear_decimal_if_available(void) {
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        watch_clear_pixel(0, 14);
-    }
+    _watch_display_clear_segment(_watch_display_driver->decimal_segment);
 }
 
 void watch_set_indicator(watch_indicator_t indicator) {
-    uint32_t value = IndicatorSegments[indicator];
-    uint8_t com = SLCD_COMNUM(value);
-    uint8_t seg = SLCD_SEGNUM(value);
-    watch_set_pixel(com, seg);
+    _watch_display_set_segment(_watch_display_driver->indicator_segments[indicator]);
 }
 
 void watch_clear_indicator(watch_indicator_t indicator) {
-    uint32_t value = IndicatorSegments[indicator];
-    uint8_t com = SLCD_COMNUM(value);
-    uint8_t seg = SLCD_SEGNUM(value);
-    watch_clear_pixel(com, seg);
+    _watch_display_clear_segment(_watch_display_driver->indicator_segments[indicator]);
+}
+
+static void _watch_display_indicator_masks(uint8_t indicators, watch_display_frame_t *masks) {
+    memset(masks, 0, sizeof(watch_display_frame_t));
+    for (uint8_t indicator = 0; indicators; indicator++, indicators >>= 1) {
+        uint8_t segid = _watch_display_driver->indicator_segments[indicator];
+        if (!(indicators & 1) || segid == WATCH_DISPLAY_NO_SEGMENT) continue;
+        if (SLCD_COMNUM(segid) < WATCH_DISPLAY_FRAME_COMS) masks->com[SLCD_COMNUM(segid)] |= (uint32_t)1 << SLCD_SEGNUM(segid);
+    }
+}
+
+void watch_set_indicators(uint8_t indicators) {
+    watch_display_frame_t masks;
+    _watch_display_indicator_masks(indicators, &masks);
+    watch_update_segments(NULL, &masks);
+}
+
+void watch_clear_indicators(uint8_t indicators) {
+    watch_display_frame_t masks;
+    _watch_display_indicator_masks(indicators, &masks);
+    watch_update_segments(&masks, NULL);
 }
 
 void watch_clear_all_indicators(void) {
-    /// TODO: Optimize this? Can be 3-4 writes to SDATAL registers
-    watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
-    watch_clear_indicator(WATCH_INDICATOR_BELL);
-    watch_clear_indicator(WATCH_INDICATOR_PM);
-    watch_clear_indicator(WATCH_INDICATOR_24H);
-    watch_clear_indicator(WATCH_INDICATOR_LAP);
-    watch_clear_indicator(WATCH_INDICATOR_ARROWS);
-    watch_clear_indicator(WATCH_INDICATOR_SLEEP);
+    watch_clear_indicators(WATCH_INDICATOR_MASK(WATCH_INDICATOR_SIGNAL) |
+                           WATCH_INDICATOR_MASK(WATCH_INDICATOR_BELL) |
+                           WATCH_INDICATOR_MASK(WATCH_INDICATOR_PM) |
+                           WATCH_INDICATOR_MASK(WATCH_INDICATOR_24H) |
+                           WATCH_INDICATOR_MASK(WATCH_INDICATOR_LAP) |
+                           WATCH_INDICATOR_MASK(WATCH_INDICATOR_ARROWS) |
+                           WATCH_INDICATOR_MASK(WATCH_INDICATOR_SLEEP));
+}
+
+void watch_update_segments(const watch_display_frame_t *clear_mask, const watch_display_frame_t *set_mask) {
+    for (uint8_t com = 0; com < WATCH_DISPLAY_FRAME_COMS; com++) {
+        uint32_t clear = clear_mask ? clear_mask->com[com] : 0;
+        uint32_t set = set_mask ? set_mask->com[com] : 0;
+        if (clear | set) watch_update_pixels(com, clear, set);
+    }
 }
 
-void _watch_update_indicator_segments(void) {
-    if (watch_get_lcd_type() == WATCH_LCD_TYPE_CUSTOM) {
-        IndicatorSegments[0] = SLCD_SEGID(0, 21); // WATCH_INDICATOR_SIGNAL
-        IndicatorSegments[1] = SLCD_SEGID(1, 21); // WATCH_INDICATOR_BELL
-        IndicatorSegments[2] = SLCD_SEGID(3, 21); // WATCH_INDICATOR_PM
-        IndicatorSegments[3] = SLCD_SEGID(2, 21); // WATCH_INDICATOR_24H
-        IndicatorSegments[4] = SLCD_SEGID(1,  0); // WATCH_INDICATOR_LAP
-        IndicatorSegments[5] = SLCD_SEGID(2,  0); // WATCH_INDICATOR_ARROWS
-        IndicatorSegments[6] = SLCD_SEGID(3,  0); // WATCH_INDICATOR_SLEEP
-        IndicatorSegments[7] = SLCD_SEGID(4,  0); // WATCH_INDICATOR_SLEEP
+void watch_display_location_segments(watch_position_t location, watch_display_frame_t *segments) {
+    const watch_display_driver_t *driver = _watch_display_driver;
+    // one bit per character position; position 10 is the custom LCD's third character at the top left.
+    uint16_t positions = 0;
+    bool bottom_one = false;
+
+    switch (location) {
+        case WATCH_POSITION_TOP:
+            positions = 0b10000001111;
+            break;
+        case WATCH_POSITION_TOP_LEFT:
+            positions = 0b10000000011;
+            break;
+        case WATCH_POSITION_TOP_RIGHT:
+            positions = 0b00000001100;
+            break;
+        case WATCH_POSITION_BOTTOM:
+            positions = 0b01111110000;
+            bottom_one = true;
+            break;
+        case WATCH_POSITION_HOURS:
+            positions = 0b00000110000;
+            bottom_one = true;
+            break;
+        case WATCH_POSITION_MINUTES:
+            positions = 0b00011000000;
+            break;
+        case WATCH_POSITION_SECONDS:
+            positions = 0b01100000000;
+            break;
+        case WATCH_POSITION_FULL:
+            positions = 0b11111111111;
+            bottom_one = true;
+            break;
+    }
+
+    memset(segments, 0, sizeof(watch_display_frame_t));
+    for (uint8_t position = 0; position < driver->num_positions; position++) {
+        if (!(positions & (1 << position))) continue;
+        const uint32_t *clear = driver->glyph_clear + position * driver->num_coms;
+        for (uint8_t com = 0; com < driver->num_coms; com++) segments->com[com] |= clear[com];
+    }
+    if (bottom_one && driver->bottom_one_segment != WATCH_DISPLAY_NO_SEGMENT) {
+        segments->com[SLCD_COMNUM(driver->bottom_one_segment)] |= (uint32_t)1 << SLCD_SEGNUM(driver->bottom_one_segment);
     }
 }
+
+void watch_start_text_blink(watch_position_t location, uint32_t duration) {
+    watch_display_frame_t segments;
+
+    watch_display_location_segments(location, &segments);
+    watch_start_segment_blink(&segments, duration);
+}
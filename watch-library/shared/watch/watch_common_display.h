@@ -506,7 +506,38 @@ static const digit_mapping_t Classic_LCD_Display_Mapping[] = {
     },
 };
 
+/// Marks a segment that an LCD doesn't have; setting or clearing it does nothing.
+#define WATCH_DISPLAY_NO_SEGMENT 0xff
+
+/// Everything the drawing functions need to know about an LCD. watch_discover_lcd_type installs the one for the LCD
+/// it finds, and every drawing call goes straight to it, so another LCD needs another one of these, not more branches.
+typedef struct {
+    watch_lcd_type_t type;
+    uint8_t num_positions;          ///< character positions, numbered as in the display mapping above
+    uint8_t num_coms;               ///< COM lines the characters are spread across
+    const uint32_t *glyph_clear;    ///< [num_positions][num_coms] segments each position owns, from watch_glyph_masks.h
+    const uint8_t *glyph_shift;     ///< [num_positions] how far glyph_set masks are shifted right
+    const uint16_t *glyph_set;      ///< [num_positions][WATCH_GLYPH_NUM_CHARACTERS][num_coms] segments each character sets
+    uint8_t indicator_segments[WATCH_INDICATOR_COLON + 1]; ///< SLCD_SEGID of each indicator, by watch_indicator_t
+    uint8_t colon_segment;          ///< SLCD_SEGID of the colon
+    uint8_t decimal_segment;        ///< SLCD_SEGID of the decimal point, if there is one
+    uint8_t bottom_one_segment;     ///< SLCD_SEGID of the leading 1 left of the bottom row, if there is one
+    bool long_text;                 ///< whether watch_display_text_with_fallback shows the string or the fallback
+} watch_display_driver_t;
+
+#if !defined(FORCE_CUSTOM_LCD_TYPE)
+extern const watch_display_driver_t Classic_LCD_Display_Driver;
+#endif
+#if !defined(FORCE_CLASSIC_LCD_TYPE)
+extern const watch_display_driver_t Custom_LCD_Display_Driver;
+#endif
+
+/// Installs a display driver. The POSIX and simulator backends can use this to try out an LCD of their own.
+void watch_display_set_driver(const watch_display_driver_t *driver);
+const watch_display_driver_t *watch_display_get_driver(void);
+
 void watch_display_character(uint8_t character, uint8_t position);
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position);
 
-void _watch_update_indicator_segments(void);
+/// Installs the built-in driver for the given type of LCD; called once the LCD type is known.
+void _watch_display_install_driver(watch_lcd_type_t type);
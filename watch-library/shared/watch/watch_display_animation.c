@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <string.h>
+#include "watch_display_animation.h"
+#include "watch_common_display.h"
+
+// the bottom row is positions 4 through 9.
+#define BOTTOM_ROW_LENGTH (6)
+
+uint8_t watch_display_marquee_frames(const char *string, watch_display_frame_t *frames, uint8_t max_frames) {
+    size_t length = strlen(string);
+    uint8_t num_frames = length + BOTTOM_ROW_LENGTH > max_frames ? max_frames : length + BOTTOM_ROW_LENGTH;
+    char window[BOTTOM_ROW_LENGTH + 1] = {0};
+
+    for (uint8_t frame = 0; frame < num_frames; frame++) {
+        // frame 0 has the first character at the right edge; the last frame has the last one just gone off the left.
+        for (uint8_t i = 0; i < BOTTOM_ROW_LENGTH; i++) {
+            int index = frame + i - (BOTTOM_ROW_LENGTH - 1);
+            window[i] = (index >= 0 && (size_t)index < length) ? string[index] : ' ';
+        }
+        watch_display_draw_into_frame(&frames[frame]);
+        watch_clear_display();
+        watch_display_text(WATCH_POSITION_BOTTOM, window);
+    }
+    watch_display_draw_into_frame(NULL);
+
+    return num_frames;
+}
+
+uint8_t watch_display_busy_frames(watch_display_frame_t *frames) {
+    for (uint8_t frame = 0; frame < WATCH_DISPLAY_BUSY_FRAMES; frame++) {
+        // out along the row, then back, without stopping twice at either end.
+        uint8_t position = frame < BOTTOM_ROW_LENGTH ? frame : WATCH_DISPLAY_BUSY_FRAMES - frame;
+        watch_display_draw_into_frame(&frames[frame]);
+        watch_clear_display();
+        watch_display_character('-', 4 + position);
+    }
+    watch_display_draw_into_frame(NULL);
+
+    return WATCH_DISPLAY_BUSY_FRAMES;
+}
+
+void watch_display_progress_bar(uint8_t percent) {
+    char buf[BOTTOM_ROW_LENGTH + 1] = {0};
+    uint8_t steps = (percent > 100 ? 100 : percent) * (BOTTOM_ROW_LENGTH * 2) / 100;
+
+    for (uint8_t i = 0; i < BOTTOM_ROW_LENGTH; i++) {
+        if (steps >= i * 2 + 2) buf[i] = '=';
+        else if (steps == i * 2 + 1) buf[i] = '_';
+        else buf[i] = ' ';
+    }
+    watch_display_text(WATCH_POSITION_BOTTOM, buf);
+}
+
+void watch_start_marquee(const char *string, watch_display_frame_t *frames, uint8_t max_frames, uint32_t duration) {
+    watch_display_frame_t segments;
+    uint8_t num_frames = watch_display_marquee_frames(string, frames, max_frames);
+
+    watch_display_location_segments(WATCH_POSITION_BOTTOM, &segments);
+    watch_start_segment_animation(&segments, frames, num_frames, duration, true);
+}
+
+void watch_start_busy_animation(watch_display_frame_t *frames, uint32_t duration) {
+    watch_display_frame_t segments;
+    uint8_t num_frames = watch_display_busy_frames(frames);
+
+    watch_display_location_segments(WATCH_POSITION_BOTTOM, &segments);
+    watch_start_segment_animation(&segments, frames, num_frames, duration, true);
+}
@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+////< @file watch_display_animation.h
+
+#include "watch.h"
+#include "watch_slcd.h"
+
+/** @addtogroup display_animation Display Animations
+  * @brief This section covers functions that draw frames for watch_start_segment_animation.
+  * @details The watch plays a segment animation on its own, a frame per frame counter period, so a face can start
+  *          a marquee or a busy animation and go back to sleep. The frames are drawn ahead of time, into memory
+  *          the face owns (its state is a good place), and have to stay there until the animation is stopped.
+  *          Drawing them goes through watch_display_draw_into_frame, so don't call these while drawing into a
+  *          frame of your own.
+  */
+/// @{
+
+/// How many frames a busy animation takes.
+#define WATCH_DISPLAY_BUSY_FRAMES (10)
+
+/** @brief Draws a string scrolling across the bottom row, from off the right edge to off the left.
+  * @param string The string to scroll.
+  * @param frames The frames to draw into. The marquee takes one per character, plus six.
+  * @param max_frames How many frames there's room for; a string too long for them is cut short.
+  * @return How many frames were drawn. The last one is blank, so the marquee can loop.
+  */
+uint8_t watch_display_marquee_frames(const char *string, watch_display_frame_t *frames, uint8_t max_frames);
+
+/** @brief Draws a dash bouncing back and forth across the bottom row.
+  * @param frames The frames to draw into; there must be room for WATCH_DISPLAY_BUSY_FRAMES of them.
+  * @return How many frames were drawn: WATCH_DISPLAY_BUSY_FRAMES.
+  */
+uint8_t watch_display_busy_frames(watch_display_frame_t *frames);
+
+/** @brief Draws a progress bar across the bottom row, in twelve steps: each position shows an underscore and then
+  *        an equals sign as the bar fills.
+  * @param percent How full the bar is, from 0 to 100.
+  */
+void watch_display_progress_bar(uint8_t percent);
+
+/** @brief Scrolls a string across the bottom row, over and over, until watch_stop_segment_animation.
+  * @param string The string to scroll.
+  * @param frames The frames to draw the marquee into; see watch_display_marquee_frames.
+  * @param max_frames How many frames there's room for.
+  * @param duration How long each step of the scroll is shown, in milliseconds, from 50 to ~4250 ms.
+  */
+void watch_start_marquee(const char *string, watch_display_frame_t *frames, uint8_t max_frames, uint32_t duration);
+
+/** @brief Bounces a dash across the bottom row, over and over, until watch_stop_segment_animation.
+  * @param frames The frames to draw the animation into; there must be room for WATCH_DISPLAY_BUSY_FRAMES of them.
+  * @param duration How long each step is shown, in milliseconds, from 50 to ~4250 ms.
+  */
+void watch_start_busy_animation(watch_display_frame_t *frames, uint32_t duration);
+
+/// @}
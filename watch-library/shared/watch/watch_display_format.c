@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_display_format.h"
+
+// 4294967295 is ten digits long.
+#define MAX_DIGITS (10)
+
+char *watch_format_unsigned(char *buf, uint32_t value, uint8_t width, char pad) {
+    char digits[MAX_DIGITS];
+    uint8_t length = 0;
+
+    // digits come out least significant first; they're written back out the other way.
+    do {
+        digits[length++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+
+    while (width > length) {
+        *buf++ = pad;
+        width--;
+    }
+    while (length) *buf++ = digits[--length];
+
+    return buf;
+}
+
+char *watch_format_signed(char *buf, int32_t value, uint8_t width, char pad) {
+    if (value >= 0) return watch_format_unsigned(buf, value, width, pad);
+
+    // negate as unsigned, so that INT32_MIN comes out right.
+    uint32_t magnitude = 0u - (uint32_t)value;
+    if (pad == '0') {
+        *buf++ = '-';
+        return watch_format_unsigned(buf, magnitude, width ? width - 1 : 0, '0');
+    }
+
+    char digits[MAX_DIGITS];
+    char *end = watch_format_unsigned(digits, magnitude, 0, ' ');
+    uint8_t length = end - digits + 1;
+    while (width > length) {
+        *buf++ = ' ';
+        width--;
+    }
+    *buf++ = '-';
+    for (char *digit = digits; digit < end; digit++) *buf++ = *digit;
+
+    return buf;
+}
+
+char *_watch_format_fixed_magnitude(char *buf, uint32_t magnitude, bool negative, uint8_t decimals, uint8_t width) {
+    char digits[MAX_DIGITS + 1];
+    // at least one digit ahead of the decimal point, as in 0.25.
+    char *end = watch_format_unsigned(digits, magnitude, decimals + 1, '0');
+    uint8_t length = end - digits + (decimals ? 1 : 0) + (negative ? 1 : 0);
+
+    while (width > length) {
+        *buf++ = ' ';
+        width--;
+    }
+    if (negative) *buf++ = '-';
+    for (char *digit = digits; digit < end; digit++) {
+        if (digit == end - decimals) *buf++ = '.';
+        *buf++ = *digit;
+    }
+
+    return buf;
+}
+
+char *watch_format_fixed(char *buf, int32_t value, uint8_t decimals, uint8_t width) {
+    if (value < 0) return _watch_format_fixed_magnitude(buf, 0u - (uint32_t)value, true, decimals, width);
+    return _watch_format_fixed_magnitude(buf, value, false, decimals, width);
+}
+
+char *watch_format_time(char *buf, uint8_t hours, uint8_t minutes, uint8_t seconds, char hour_pad) {
+    buf = watch_format_unsigned(buf, hours, 2, hour_pad);
+    buf = watch_format_unsigned(buf, minutes, 2, '0');
+    return watch_format_unsigned(buf, seconds, 2, '0');
+}
+
+void watch_display_unsigned(watch_position_t location, uint32_t value, char pad) {
+    char buf[7];
+    uint8_t width;
+
+    switch (location) {
+        case WATCH_POSITION_BOTTOM:
+            width = 6;
+            value %= 1000000;
+            break;
+        case WATCH_POSITION_FULL:
+            return;
+        default:
+            width = 2;
+            value %= 100;
+            break;
+    }
+
+    *watch_format_unsigned(buf, value, width, pad) = '\0';
+    watch_display_text(location, buf);
+}
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+////< @file watch_display_format.h
+
+#include "watch.h"
+#include "watch_slcd.h"
+
+/** @addtogroup display_format Display Formatting
+  * @brief This section covers functions that write numbers for the display without going through printf.
+  * @details sprintf is the usual way to get a number onto the display, but it's a lot of code to pull in for a few
+  *          digits, and %f brings the float side of it along too. These write straight into a buffer and return a
+  *          pointer just past what they wrote, so they can be strung together to build a line:
+  *
+  *              char buf[7];
+  *              char *p = watch_format_time(buf, hours, minutes, seconds, ' ');
+  *              *p = '\0';
+  *              watch_display_text(WATCH_POSITION_BOTTOM, buf);
+  *
+  *          They don't terminate the string; put a '\0' after the last one. Like printf, a number too wide for
+  *          its field is written in full, so leave room for the widest one you expect.
+  */
+/// @{
+
+/** @brief Writes an unsigned number right-aligned in a field, like printf's %*u or %0*u.
+  * @param buf Where to write it.
+  * @param value The number to write.
+  * @param width The smallest number of characters to write.
+  * @param pad The character to fill the field with: '0' or ' '.
+  * @return A pointer just past the last character written.
+  */
+char *watch_format_unsigned(char *buf, uint32_t value, uint8_t width, char pad);
+
+/** @brief Writes a signed number right-aligned in a field, like printf's %*d or %0*d. The minus sign counts toward
+  *        the width; it goes right before the digits when padding with spaces, and at the start of the field when
+  *        padding with zeroes.
+  * @param buf Where to write it.
+  * @param value The number to write.
+  * @param width The smallest number of characters to write.
+  * @param pad The character to fill the field with: '0' or ' '.
+  * @return A pointer just past the last character written.
+  */
+char *watch_format_signed(char *buf, int32_t value, uint8_t width, char pad);
+
+/** @brief Writes a fixed-point number right-aligned in a field of spaces, like printf's %*.*f.
+  * @param buf Where to write it.
+  * @param value The number to write, in units of the last decimal place (so 1234 with two decimals is 12.34).
+  * @param decimals How many digits to write after the decimal point, up to 9.
+  * @param width The smallest number of characters to write, counting the sign and the decimal point.
+  * @return A pointer just past the last character written.
+  */
+char *watch_format_fixed(char *buf, int32_t value, uint8_t decimals, uint8_t width);
+
+/** @brief Writes a time as six digits, HHMMSS, for the bottom row of the display.
+  * @param buf Where to write it.
+  * @param hours The hour; this is written in two characters, padded with hour_pad.
+  * @param minutes The minute, written as two digits.
+  * @param seconds The second, written as two digits.
+  * @param hour_pad The character to pad a one-digit hour with: ' ' as on a clock, or '0'.
+  * @return A pointer just past the last character written.
+  */
+char *watch_format_time(char *buf, uint8_t hours, uint8_t minutes, uint8_t seconds, char hour_pad);
+
+/** @brief Displays an unsigned number at one of the display's locations, filling it.
+  * @param location @see watch_position_t. The top left and right, hours, minutes and seconds hold two digits; the
+  *                 bottom row holds six. WATCH_POSITION_FULL isn't supported.
+  * @param value The number to display. Only the digits that fit are shown.
+  * @param pad The character to fill the location with: '0' or ' '.
+  */
+void watch_display_unsigned(watch_position_t location, uint32_t value, char pad);
+
+/// @}
+
+/// Writes a fixed-point number from its magnitude and sign, so that negative zero can come out as printf writes it.
+char *_watch_format_fixed_magnitude(char *buf, uint32_t magnitude, bool negative, uint8_t decimals, uint8_t width);
@@ -62,6 +62,9 @@ typedef enum {
     WATCH_INDICATOR_COLON,      ///< The colon between hours and minutes.
 } watch_indicator_t;
 
+/// A set of indicators, for watch_set_indicators and watch_clear_indicators: OR together WATCH_INDICATOR_MASK(x) values.
+#define WATCH_INDICATOR_MASK(indicator) (1u << (indicator))
+
 /// An enum listing the locations on the display where text can be placed.
 typedef enum {
     WATCH_POSITION_FULL = 0,    ///< Display 10 characters to the full screen, in the standard F-91W layout.
@@ -98,6 +101,15 @@ typedef enum {
   */
 void watch_enable_display(void);
 
+/** @brief Writes everything drawn since the last commit to the display.
+  * @details Setting and clearing pixels only changes a copy of the segment data in RAM; this copies the words that
+  *          changed to the SLCD's segment data registers, so a full line of text costs a handful of register writes
+  *          instead of one read-modify-write per segment. Movement commits at the end of every pass through its run
+  *          loop, so a watch face only needs to call this if it wants something shown before it returns (say, right
+  *          before a delay_ms).
+  */
+void watch_display_commit(void);
+
 /** @brief Sets a pixel. Use this to manually set a pixel with a given common and segment number.
   *        See <a href="segmap.html">segmap.html</a>.
   * @param com the common pin, numbered from 0-2.
@@ -112,10 +124,57 @@ void watch_set_pixel(uint8_t com, uint8_t seg);
   */
 void watch_clear_pixel(uint8_t com, uint8_t seg);
 
+/** @brief Clears and then sets any number of pixels on one common pin, in one go.
+  * @param com the common pin, numbered from 0-3.
+  * @param clear_mask the segments to clear, where bit n is segment n.
+  * @param set_mask the segments to set once those are cleared.
+  */
+void watch_update_pixels(uint8_t com, uint32_t clear_mask, uint32_t set_mask);
+
 /** @brief Clears all segments of the display, including incicators and the colon.
   */
 void watch_clear_display(void);
 
+/// The number of common pins a display frame covers: three on the classic LCD, four on the custom one.
+#define WATCH_DISPLAY_FRAME_COMS 4
+
+/** @brief The state of every segment on the display, as the SLCD stores it: one word per common pin, where bit n
+  *        is segment n. Drawing into a frame and showing it later lets you do the work of drawing ahead of time.
+  */
+typedef struct {
+    uint32_t com[WATCH_DISPLAY_FRAME_COMS];
+} watch_display_frame_t;
+
+/** @brief Copies what's been drawn on the display into a frame, whether or not it has been committed yet.
+  * @param frame The frame to fill in.
+  */
+void watch_display_capture_frame(watch_display_frame_t *frame);
+
+/** @brief Puts a frame on the display, all at once, as of the next watch_display_commit. This only copies four
+  *        words, so it's much cheaper than drawing the same thing one character at a time.
+  * @param frame The frame to show.
+  */
+void watch_display_show_frame(const watch_display_frame_t *frame);
+
+/** @brief Sends all drawing to a frame instead of the display, until you call this again with NULL. Everything that
+  *        sets or clears pixels (including watch_display_text and watch_clear_display) goes to the frame; blinking
+  *        and the sleep animation are run by the SLCD itself, and still happen on the display.
+  * @param frame The frame to draw into, or NULL to draw on the display again.
+  */
+void watch_display_draw_into_frame(watch_display_frame_t *frame);
+
+/** @brief Clears and then sets segments anywhere on the display, with one update per common pin that has any.
+  * @param clear_mask The segments to clear, or NULL to clear none.
+  * @param set_mask The segments to set once those are cleared, or NULL to set none.
+  */
+void watch_update_segments(const watch_display_frame_t *clear_mask, const watch_display_frame_t *set_mask);
+
+/** @brief Fills in a frame with every segment that text at the given location can use, on the LCD in use.
+  * @param location @see watch_position_t, the location you're interested in.
+  * @param segments The frame to fill in.
+  */
+void watch_display_location_segments(watch_position_t location, watch_display_frame_t *segments);
+
 /** @brief Displays a string at the given position, starting from the top left. There are ten digits.
            A space in any position will clear that digit.
   * @deprecated Use `watch_display_text` and `watch_display_text_with_fallback` instead.
@@ -219,6 +278,16 @@ void watch_set_indicator(watch_indicator_t indicator);
   */
 void watch_clear_indicator(watch_indicator_t indicator);
 
+/** @brief Sets several indicators at once, with one update per common pin instead of one per indicator.
+  * @param indicators The indicators to set, e.g. WATCH_INDICATOR_MASK(WATCH_INDICATOR_PM) | WATCH_INDICATOR_MASK(WATCH_INDICATOR_BELL)
+  */
+void watch_set_indicators(uint8_t indicators);
+
+/** @brief Clears several indicators at once, with one update per common pin instead of one per indicator.
+  * @param indicators The indicators to clear, as for watch_set_indicators.
+  */
+void watch_clear_indicators(uint8_t indicators);
+
 /** @brief Clears all indicator segments.
   * @see watch_indicator_t
   */
@@ -248,9 +317,51 @@ void watch_start_character_blink(char character, uint32_t duration);
   */
 void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32_t duration);
 
+/** @brief Blinks any set of segments, whatever they are showing, until watch_stop_blink.
+  * @details Unlike watch_start_character_blink, this works anywhere on either LCD: the segments keep whatever you
+  *          draw in them, and the watch blanks them every other frame counter period. This takes a brief interrupt
+  *          at each half of the blink, but no face code, so a settings editor can blink a field at 1 Hz ticks (or
+  *          no ticks at all) instead of asking for 4 Hz ticks just to redraw it.
+  * @param segments The segments to blink, one bit per segment as in watch_display_frame_t.
+  * @param duration How long the segments stay lit, and then dark, in milliseconds, from 50 to ~4250 ms.
+  * @note Starting another segment blink replaces this one.
+  */
+void watch_start_segment_blink(const watch_display_frame_t *segments, uint32_t duration);
+
+/** @brief Blinks whatever is displayed at the given location, as watch_start_segment_blink.
+  * @param location @see watch_position_t, the location you wish to blink.
+  * @param duration How long the location stays lit, and then dark, in milliseconds, from 50 to ~4250 ms.
+  */
+void watch_start_text_blink(watch_position_t location, uint32_t duration);
+
+/** @brief Plays a sequence of frames in some segments of the display, leaving the rest of it alone.
+  * @details Like watch_start_segment_blink, this runs on its own: each frame counter period, the watch shows the
+  *          next frame in the given segments, without waking the face. Segments outside of the mask keep whatever
+  *          is drawn in them, and drawing in the masked segments is kept, but hidden, until the animation stops.
+  *          watch_display_animation.h has functions that fill in frames for marquees and busy animations.
+  * @param segments The segments the animation takes over.
+  * @param frames The frames to show; only the segments in the mask matter. These are read as the animation
+  *               plays, so they must stay put (in a face's state, say) until it's stopped.
+  * @param num_frames How many frames there are.
+  * @param duration How long each frame is shown, in milliseconds, from 50 to ~4250 ms.
+  * @param loop true to start over after the last frame; false to stop there and hold it.
+  * @note The animation shares its frame counter with watch_start_segment_blink; starting either replaces the other.
+  */
+void watch_start_segment_animation(const watch_display_frame_t *segments, const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration, bool loop);
+
+/** @brief Checks whether a segment animation is still advancing.
+  * @return true if an animation is playing; false if there is none, or a one-shot animation is holding its last frame.
+  */
+bool watch_segment_animation_is_running(void);
+
+/** @brief Stops the segment animation, if there is one, and shows what's drawn in its segments again.
+  */
+void watch_stop_segment_animation(void);
+
 /** @brief Stops and clears all blinking segments.
   * @details This will stop all blinking in position 7, and clear all segments in that digit.
-  *          On the Pro LCD, this will also stop the blinking of all indicators.
+  *          On the Pro LCD, this will also stop the blinking of all indicators. Segments blinked with
+  *          watch_start_segment_blink or watch_start_text_blink are left lit.
   */
 void watch_stop_blink(void);
 
@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+////< @file watch_timer.h
+
+#include "watch.h"
+
+/** @addtogroup timer One-Shot Timer
+  * @brief This section covers functions related to a free-running 1024 Hz counter with a single compare interrupt.
+  * @details The RTC's periodic callbacks are the right tool for something that has to happen over and over, but
+  *          they're a poor fit for something that has to happen once, a fraction of a second from now: a 128 Hz
+  *          callback that waits half a second for a long press wakes the watch 64 times to do it. This timer
+  *          wakes it once. It counts at 1024 Hz (on the watch, TC3 clocked from the same 1024 Hz clock as the
+  *          buzzer) and keeps counting in STANDBY, so its count doubles as a timestamp for things like button
+  *          presses. The count is 16 bits wide and wraps every 64 seconds; compare two counts by subtracting
+  *          them, and keep deadlines less than 32 seconds out.
+  *
+  *          The counter only runs while enabled. Leave it off when nothing is waiting on it.
+  */
+/// @{
+
+#define WATCH_TIMER_TICKS_PER_SECOND (1024)
+
+/** @brief Starts the counter from zero, if it isn't already running.
+  */
+void watch_timer_enable(void);
+
+/** @brief Stops the counter, and cancels the compare callback if there was one.
+  */
+void watch_timer_disable(void);
+
+/** @brief Checks whether the counter is running.
+  * @return true if watch_timer_enable has been called since the last call to watch_timer_disable.
+  */
+bool watch_timer_is_enabled(void);
+
+/** @brief Returns the current count.
+  * @return The number of 1/1024 second ticks since the counter was enabled, modulo 65536; 0 if it isn't running.
+  */
+uint16_t watch_timer_get_count(void);
+
+/** @brief Registers a callback to be called once, when the counter reaches the given count.
+  * @param callback The function you wish to have called. It is called from an interrupt, and may register the
+  *                 next compare callback.
+  * @param count The count at which to call it. If the counter is already past this count, the callback won't
+  *              happen until the counter wraps around to it again, so check watch_timer_get_count afterwards
+  *              if the deadline was close.
+  * @note There is only one compare callback; registering another replaces it.
+  */
+void watch_timer_register_compare_callback(watch_cb_t callback, uint16_t count);
+
+/** @brief Cancels the compare callback, if there was one. The counter keeps running.
+  */
+void watch_timer_disable_compare_callback(void);
+
+/// @}
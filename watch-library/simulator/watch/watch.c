@@ -11,3 +11,10 @@ bool watch_is_usb_enabled(void) {
 void watch_reset_to_bootloader(void) {
     // No bootloader in the simulator; nothing to do here
 }
+
+void watch_enter_critical_section(void) {
+    // interrupts are browser callbacks, and the browser runs them one at a time; they can't land in the middle of anything.
+}
+
+void watch_exit_critical_section(void) {
+}
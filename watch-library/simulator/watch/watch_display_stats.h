@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+
+/// What the simulator's display has been asked to do, for profiling how much drawing a face does. Movement drains
+/// every queued event in one pass through its loop and commits once at the end, so a commit can hold the drawing of
+/// several events; the per-event counts are kept separately, in watch_display_event_stats_t.
+typedef struct {
+    uint32_t commits;           ///< calls to watch_display_commit
+    uint32_t frames;            ///< commits that changed what's on the display
+    uint32_t writes;            ///< segment updates drawn: each pixel set or cleared, each watch_update_pixels, and
+                                ///< each COM line of a watch_clear_display
+    uint32_t unchanged_writes;  ///< writes that left their segments as they already were
+    uint32_t words_written;     ///< COM lines the commits changed; each would be one SLCD register write on the watch
+} watch_display_stats_t;
+
+/// The writes drawn while a face handled one type of event.
+typedef struct {
+    uint32_t events;            ///< events of this type handled
+    uint32_t writes;            ///< as in watch_display_stats_t
+    uint32_t unchanged_writes;  ///< as in watch_display_stats_t
+} watch_display_event_stats_t;
+
+#define WATCH_DISPLAY_STATS_NUM_EVENTS (32)
+
+/// The counters since the simulator started, or since they were last reset. This also brings the page's copy of
+/// them up to date.
+const watch_display_stats_t *watch_display_get_stats(void);
+/// The counters for the last commit alone.
+const watch_display_stats_t *watch_display_get_last_commit_stats(void);
+/// The counters for one event type; event_type 0 collects whatever was drawn outside of a face's loop.
+const watch_display_event_stats_t *watch_display_get_event_stats(uint8_t event_type);
+void watch_display_reset_stats(void);
+
+/// Counts the writes that follow against event_type, until the next call. Movement calls this around each call to a
+/// face's loop, and with 0 once the face returns.
+void watch_display_stats_begin_event(uint8_t event_type);
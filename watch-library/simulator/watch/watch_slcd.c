@@ -24,7 +24,9 @@
 
 #include "watch_slcd.h"
 #include "watch_common_display.h"
+#include "watch_display_stats.h"
 
+#include <string.h>
 #include <emscripten.h>
 #include <emscripten/html5.h>
 
@@ -36,6 +38,7 @@ static bool blink_state;
 static long blink_interval_id = - 1;
 static bool tick_state;
 static long tick_interval_id = -1;
+static long segment_blink_interval_id = -1;
 
 watch_lcd_type_t watch_get_lcd_type(void) {
 #if defined(FORCE_CUSTOM_LCD_TYPE)
@@ -46,9 +49,7 @@ watch_lcd_type_t watch_get_lcd_type(void) {
 }
 
 void watch_enable_display(void) {
-#if defined(FORCE_CUSTOM_LCD_TYPE)
-    _watch_update_indicator_segments();
-#endif
+    _watch_display_install_driver(watch_get_lcd_type());
 
     EM_ASM({
 #if defined(FORCE_CUSTOM_LCD_TYPE)
@@ -58,34 +59,176 @@ void watch_enable_display(void) {
 #endif
     });
 
+    // start from a blank page, so that it matches _segments.
+    EM_ASM({
+        document.querySelectorAll("[data-com][data-seg]")
+            .forEach((e) => e.style.opacity = 0);
+    });
     watch_clear_display();
 }
 
+// the page can't tell us what it's showing, so we keep our own copy of that in _segments.
+static watch_display_frame_t _segments;
+// everything draws into _shadow; watch_display_commit updates the page where it differs from _segments.
+static watch_display_frame_t _shadow;
+// when a face is drawing ahead of time, pixels go here instead.
+static watch_display_frame_t *_draw_target = &_shadow;
+// updates drawn into _shadow since the last commit, counted in _pending, then totalled up in _stats at each commit.
+static watch_display_stats_t _pending;
+static watch_display_stats_t _last_commit;
+static watch_display_stats_t _stats;
+// the same writes again, by the event the face was handling when it drew them.
+static watch_display_event_stats_t _event_stats[WATCH_DISPLAY_STATS_NUM_EVENTS];
+static uint8_t _current_event;
+// segments blinked by watch_start_segment_blink, and whether they're in the dark half of the blink.
+static watch_display_frame_t _blink_segments;
+static bool _blink_segments_dark = false;
+// segments animated by watch_start_segment_animation, and the frame they're showing.
+static watch_display_frame_t _animation_segments;
+static const watch_display_frame_t *_animation_frames = NULL;
+static uint8_t _animation_num_frames;
+static uint8_t _animation_step;
+static bool _animation_loop;
+static long animation_interval_id = -1;
+
+static inline void _watch_count_write(uint32_t before, uint32_t after) {
+    // drawing ahead of time into a frame doesn't count; showing the frame does.
+    if (_draw_target != &_shadow) return;
+    _pending.writes++;
+    _event_stats[_current_event].writes++;
+    if (before == after) {
+        _pending.unchanged_writes++;
+        _event_stats[_current_event].unchanged_writes++;
+    }
+}
+
 void watch_set_pixel(uint8_t com, uint8_t seg) {
-    EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 1);
-    }, com, seg);
+    if (com >= WATCH_DISPLAY_FRAME_COMS || seg >= 32) return;
+    uint32_t before = _draw_target->com[com];
+    _draw_target->com[com] |= (uint32_t)1 << seg;
+    _watch_count_write(before, _draw_target->com[com]);
 }
 
 void watch_clear_pixel(uint8_t com, uint8_t seg) {
-    EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 0);
-    }, com, seg);
+    if (com >= WATCH_DISPLAY_FRAME_COMS || seg >= 32) return;
+    uint32_t before = _draw_target->com[com];
+    _draw_target->com[com] &= ~((uint32_t)1 << seg);
+    _watch_count_write(before, _draw_target->com[com]);
+}
+
+void watch_update_pixels(uint8_t com, uint32_t clear_mask, uint32_t set_mask) {
+    if (com >= WATCH_DISPLAY_FRAME_COMS) return;
+    uint32_t before = _draw_target->com[com];
+    _draw_target->com[com] = (_draw_target->com[com] & ~clear_mask) | set_mask;
+    _watch_count_write(before, _draw_target->com[com]);
 }
 
 void watch_clear_display(void) {
+    for (uint8_t com = 0; com < WATCH_DISPLAY_FRAME_COMS; com++) {
+        uint32_t before = _draw_target->com[com];
+        _draw_target->com[com] = 0;
+        _watch_count_write(before, 0);
+    }
+}
+
+static void _watch_display_publish_stats(void) {
+    // the page keeps these in lcd_stats, to show them or for a test to read back.
     EM_ASM({
-        document.querySelectorAll("[data-com][data-seg]")
-            .forEach((e) => e.style.opacity = 0);
-    });
+        lcd_stats = { commits: $0 >>> 0, frames: $1 >>> 0, writes: $2 >>> 0, unchanged_writes: $3 >>> 0, words_written: $4 >>> 0,
+                      last: { writes: $5 >>> 0, unchanged_writes: $6 >>> 0, words_written: $7 >>> 0 } };
+    }, _stats.commits, _stats.frames, _stats.writes, _stats.unchanged_writes, _stats.words_written,
+       _last_commit.writes, _last_commit.unchanged_writes, _last_commit.words_written);
+}
+
+void watch_display_commit(void) {
+    uint32_t visible[WATCH_DISPLAY_FRAME_COMS];
+    uint32_t changed[WATCH_DISPLAY_FRAME_COMS];
+    uint32_t words_written = 0;
+
+    for (uint8_t com = 0; com < WATCH_DISPLAY_FRAME_COMS; com++) {
+        visible[com] = _blink_segments_dark ? _shadow.com[com] & ~_blink_segments.com[com] : _shadow.com[com];
+        if (_animation_frames != NULL) {
+            uint32_t animated = _animation_segments.com[com];
+            visible[com] = (visible[com] & ~animated) | (_animation_frames[_animation_step].com[com] & animated);
+        }
+        changed[com] = visible[com] ^ _segments.com[com];
+        if (changed[com]) words_written++;
+        _segments.com[com] = visible[com];
+    }
+
+    // one trip into JavaScript for the whole frame, however many segments it changes.
+    if (words_written) {
+        EM_ASM({
+            var changed = [$0, $1, $2, $3];
+            var visible = [$4, $5, $6, $7];
+            for (var com = 0; com < 4; com++) {
+                for (var seg = 0; seg < 32; seg++) {
+                    if (!((changed[com] >>> seg) & 1)) continue;
+                    document.querySelectorAll("[data-com='" + com + "'][data-seg='" + seg + "']")
+                        .forEach((e) => e.style.opacity = (visible[com] >>> seg) & 1);
+                }
+            }
+        }, changed[0], changed[1], changed[2], changed[3], visible[0], visible[1], visible[2], visible[3]);
+    }
+
+    _pending.commits = 1;
+    _pending.frames = words_written ? 1 : 0;
+    _pending.words_written = words_written;
+    _last_commit = _pending;
+    _stats.commits += _pending.commits;
+    _stats.frames += _pending.frames;
+    _stats.writes += _pending.writes;
+    _stats.unchanged_writes += _pending.unchanged_writes;
+    _stats.words_written += _pending.words_written;
+    memset(&_pending, 0, sizeof(_pending));
+
+    // a commit that drew nothing only bumps the commit count, which can wait until something else changes.
+    if (_last_commit.writes || _last_commit.words_written) _watch_display_publish_stats();
+}
+
+const watch_display_stats_t *watch_display_get_stats(void) {
+    _watch_display_publish_stats();
+    return &_stats;
+}
+
+const watch_display_stats_t *watch_display_get_last_commit_stats(void) {
+    return &_last_commit;
+}
+
+const watch_display_event_stats_t *watch_display_get_event_stats(uint8_t event_type) {
+    if (event_type >= WATCH_DISPLAY_STATS_NUM_EVENTS) return NULL;
+    return &_event_stats[event_type];
+}
+
+void watch_display_reset_stats(void) {
+    memset(&_stats, 0, sizeof(_stats));
+    memset(&_last_commit, 0, sizeof(_last_commit));
+    memset(_event_stats, 0, sizeof(_event_stats));
+    _watch_display_publish_stats();
+}
+
+void watch_display_stats_begin_event(uint8_t event_type) {
+    _current_event = event_type < WATCH_DISPLAY_STATS_NUM_EVENTS ? event_type : 0;
+    if (_current_event) _event_stats[_current_event].events++;
+}
+
+void watch_display_capture_frame(watch_display_frame_t *frame) {
+    *frame = _shadow;
+}
+
+void watch_display_show_frame(const watch_display_frame_t *frame) {
+    _shadow = *frame;
+}
+
+void watch_display_draw_into_frame(watch_display_frame_t *frame) {
+    _draw_target = frame ? frame : &_shadow;
 }
 
 static void watch_invoke_blink_callback(void *userData) {
     blink_state = !blink_state;
     watch_display_character(blink_state ? blink_character : ' ', 7);
     watch_clear_pixel(2, 10); // clear segment B of position 7 since it can't blink
+    watch_display_commit();
 }
 
 void watch_start_character_blink(char character, uint32_t duration) {
@@ -102,10 +245,80 @@ void watch_start_indicator_blink_if_possible(watch_indicator_t indicator, uint32
     /// TODO: For #SecondMovement, implement this on simulator
 }
 
+static void watch_invoke_segment_blink_callback(void *userData) {
+    _blink_segments_dark = !_blink_segments_dark;
+    watch_display_commit();
+}
+
+static void watch_stop_segment_blink(void) {
+    if (segment_blink_interval_id == -1) return;
+    emscripten_clear_interval(segment_blink_interval_id);
+    segment_blink_interval_id = -1;
+    _blink_segments_dark = false;
+    watch_display_commit();
+    memset(&_blink_segments, 0, sizeof(_blink_segments));
+}
+
+void watch_start_segment_blink(const watch_display_frame_t *segments, uint32_t duration) {
+    // on the watch, blinks and animations share a frame counter, so one replaces the other.
+    watch_stop_segment_animation();
+    watch_stop_segment_blink();
+    _blink_segments = *segments;
+    _blink_segments_dark = false;
+    watch_display_commit();
+
+    segment_blink_interval_id = emscripten_set_interval(watch_invoke_segment_blink_callback, (double)duration, NULL);
+}
+
 void watch_stop_blink(void) {
     emscripten_clear_timeout(blink_interval_id);
     blink_interval_id = -1;
     blink_state = false;
+
+    watch_stop_segment_blink();
+}
+
+static void watch_invoke_animation_callback(void *userData) {
+    if (_animation_step + 1 < _animation_num_frames) {
+        _animation_step++;
+    } else if (_animation_loop) {
+        _animation_step = 0;
+    } else {
+        // a one-shot animation holds its last frame until it's stopped.
+        emscripten_clear_interval(animation_interval_id);
+        animation_interval_id = -1;
+        return;
+    }
+    watch_display_commit();
+}
+
+void watch_start_segment_animation(const watch_display_frame_t *segments, const watch_display_frame_t *frames, uint8_t num_frames, uint32_t duration, bool loop) {
+    if (num_frames == 0) return;
+    watch_stop_segment_blink();
+    watch_stop_segment_animation();
+    _animation_segments = *segments;
+    _animation_frames = frames;
+    _animation_num_frames = num_frames;
+    _animation_step = 0;
+    _animation_loop = loop;
+    watch_display_commit();
+
+    if (num_frames > 1) animation_interval_id = emscripten_set_interval(watch_invoke_animation_callback, (double)duration, NULL);
+}
+
+bool watch_segment_animation_is_running(void) {
+    return animation_interval_id != -1;
+}
+
+void watch_stop_segment_animation(void) {
+    if (animation_interval_id != -1) {
+        emscripten_clear_interval(animation_interval_id);
+        animation_interval_id = -1;
+    }
+    if (_animation_frames != NULL) {
+        _animation_frames = NULL;
+        watch_display_commit();
+    }
 }
 
 static void watch_invoke_tick_callback(void *userData) {
@@ -117,6 +330,7 @@ static void watch_invoke_tick_callback(void *userData) {
         watch_clear_pixel(0, 3);
         watch_set_pixel(0, 2);
     }
+    watch_display_commit();
 }
 
 void watch_start_sleep_animation(uint32_t duration) {
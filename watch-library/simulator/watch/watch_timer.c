@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_timer.h"
+#include "watch_main_loop.h"
+
+#include <emscripten.h>
+#include <emscripten/html5.h>
+
+// The browser has no counter to borrow, so the count is derived from performance.now(), and the compare is a timeout.
+
+static bool _timer_enabled = false;
+static double _enabled_at;
+static long _compare_timeout_id = -1;
+
+void watch_timer_enable(void) {
+    if (_timer_enabled) return;
+
+    _enabled_at = emscripten_get_now();
+    _timer_enabled = true;
+}
+
+void watch_timer_disable(void) {
+    watch_timer_disable_compare_callback();
+    _timer_enabled = false;
+}
+
+bool watch_timer_is_enabled(void) {
+    return _timer_enabled;
+}
+
+uint16_t watch_timer_get_count(void) {
+    if (!_timer_enabled) return 0;
+
+    return (uint64_t)((emscripten_get_now() - _enabled_at) * WATCH_TIMER_TICKS_PER_SECOND / 1000) & 0xFFFF;
+}
+
+static void watch_invoke_compare_callback(void *userData) {
+    watch_cb_t callback = userData;
+
+    _compare_timeout_id = -1;
+    callback();
+    resume_main_loop();
+}
+
+void watch_timer_register_compare_callback(watch_cb_t callback, uint16_t count) {
+    if (!_timer_enabled) return;
+
+    watch_timer_disable_compare_callback();
+    if (callback == NULL) return;
+
+    // like the hardware, a count that has already gone by comes around again after the counter wraps.
+    uint32_t ticks = (uint16_t)(count - watch_timer_get_count());
+    if (ticks == 0) ticks = UINT16_MAX + 1;
+    _compare_timeout_id = emscripten_set_timeout(watch_invoke_compare_callback, ticks * 1000.0 / WATCH_TIMER_TICKS_PER_SECOND, (void *)callback);
+}
+
+void watch_timer_disable_compare_callback(void) {
+    if (_compare_timeout_id != -1) {
+        emscripten_clear_timeout(_compare_timeout_id);
+        _compare_timeout_id = -1;
+    }
+}